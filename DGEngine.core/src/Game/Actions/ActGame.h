@@ -2,6 +2,8 @@
 
 #include "Game/Action.h"
 #include "Game/Game.h"
+#include "Game/Utils/FileUtils.h"
+#include "Utils/Profiler.h"
 #include "Utils/Utils.h"
 
 class ActGameAddToProperty : public Action
@@ -116,6 +118,24 @@ public:
 	}
 };
 
+class ActGameSaveProfile : public Action
+{
+private:
+	std::string file;
+
+public:
+	ActGameSaveProfile(const std::string_view file_) : file(file_) {}
+
+	bool execute(Game& game) override
+	{
+		if (Profiler::Enabled() == true)
+		{
+			FileUtils::saveText(game.getVarOrPropStringS(file), Profiler::getChromeTrace());
+		}
+		return true;
+	}
+};
+
 class ActGameSetGamma : public Action
 {
 private:
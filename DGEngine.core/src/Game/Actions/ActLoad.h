@@ -64,13 +64,16 @@ class ActLoadRandom : public Action
 private:
 	std::vector<std::string> args;
 	std::string endsWith;
+	RandomStream stream;
 
 public:
-	ActLoadRandom(std::vector<std::string>&& args_, const std::string_view endsWith_)
-		: args(std::move(args_)), endsWith(endsWith_) {}
+	ActLoadRandom(std::vector<std::string>&& args_, const std::string_view endsWith_,
+		RandomStream stream_ = RandomStream::Cosmetic)
+		: args(std::move(args_)), endsWith(endsWith_), stream(stream_) {}
 
-	ActLoadRandom(const std::string_view file_, const std::string_view endsWith_)
-		: args(), endsWith(endsWith_)
+	ActLoadRandom(const std::string_view file_, const std::string_view endsWith_,
+		RandomStream stream_ = RandomStream::Cosmetic)
+		: args(), endsWith(endsWith_), stream(stream_)
 	{
 		args.push_back(std::string(file_));
 	}
@@ -83,7 +86,7 @@ public:
 
 			if (files.size() > 0)
 			{
-				auto idx = Random::get(files.size() - 1);
+				auto idx = Random::get(stream, files.size() - 1);
 				auto file = files[idx];
 
 				if (args.size() == 1)
@@ -6,8 +6,8 @@
 class ActPaletteReplace : public Action
 {
 private:
-	std::string idDstPal;
-	std::string idSrcPal;
+	ResourceHandle<Palette> dstPalette;
+	ResourceHandle<Palette> srcPalette;
 	size_t srcStart;
 	size_t size;
 	size_t dstStart;
@@ -17,13 +17,13 @@ private:
 public:
 	ActPaletteReplace(const std::string_view idDstPal_, const std::string_view idSrcPal_,
 		size_t srcStart_, size_t size_, size_t dstStart_, bool stepReplace_) noexcept
-		: idDstPal(idDstPal_), idSrcPal(idSrcPal_), srcStart(srcStart_),
+		: dstPalette(idDstPal_), srcPalette(idSrcPal_), srcStart(srcStart_),
 		size(size_), dstStart(dstStart_), step((int)size_), stepReplace(stepReplace_) {}
 
 	bool execute(Game& game) override
 	{
-		auto dstPal = game.Resources().getPalette(idDstPal);
-		auto srcPal = game.Resources().getPalette(idSrcPal);
+		auto dstPal = game.Resources().get(dstPalette);
+		auto srcPal = game.Resources().get(srcPalette);
 		if (dstPal != nullptr && srcPal != nullptr)
 		{
 			if (stepReplace == false)
@@ -50,21 +50,21 @@ public:
 class ActPaletteShiftLeft : public Action
 {
 private:
-	std::string id;
+	ResourceHandle<Palette> palette;
 	size_t shift;
 	std::pair<size_t, size_t> range;
 
 public:
 	ActPaletteShiftLeft(const std::string_view id_, size_t shift_,
 		const std::pair<size_t, size_t>& range_) noexcept
-		: id(id_), shift(shift_), range(range_) {}
+		: palette(id_), shift(shift_), range(range_) {}
 
 	bool execute(Game& game) override
 	{
-		auto palette = game.Resources().getPalette(id);
-		if (palette != nullptr)
+		auto pal = game.Resources().get(palette);
+		if (pal != nullptr)
 		{
-			palette->shiftLeft(shift, range.first, range.second);
+			pal->shiftLeft(shift, range.first, range.second);
 		}
 		return false;
 	}
@@ -73,21 +73,21 @@ public:
 class ActPaletteShiftRight : public Action
 {
 private:
-	std::string id;
+	ResourceHandle<Palette> palette;
 	size_t shift;
 	std::pair<size_t, size_t> range;
 
 public:
 	ActPaletteShiftRight(const std::string_view id_, size_t shift_,
 		const std::pair<size_t, size_t>& range_) noexcept
-		: id(id_), shift(shift_), range(range_) {}
+		: palette(id_), shift(shift_), range(range_) {}
 
 	bool execute(Game& game) override
 	{
-		auto palette = game.Resources().getPalette(id);
-		if (palette != nullptr)
+		auto pal = game.Resources().get(palette);
+		if (pal != nullptr)
 		{
-			palette->shiftRight(shift, range.first, range.second);
+			pal->shiftRight(shift, range.first, range.second);
 		}
 		return false;
 	}
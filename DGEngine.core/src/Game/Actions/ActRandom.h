@@ -2,21 +2,25 @@
 
 #include "Game/Action.h"
 #include "Game/Game.h"
+#include <optional>
 #include "Utils/Random.h"
 
 class ActRandomList : public Action
 {
 private:
 	std::vector<std::shared_ptr<Action>> actions;
+	RandomStream stream;
 
 public:
+	ActRandomList(RandomStream stream_ = RandomStream::Default) noexcept : stream(stream_) {}
+
 	void add(const std::shared_ptr<Action>& action) { actions.push_back(action); }
 
 	bool execute(Game& game) override
 	{
 		if (actions.empty() == false)
 		{
-			auto idx = Random::get<size_t>(actions.size() - 1);
+			auto idx = Random::get<size_t>(stream, actions.size() - 1);
 			if (actions[idx] != nullptr)
 			{
 				actions[idx]->execute(game);
@@ -26,21 +30,51 @@ public:
 	}
 };
 
+class ActRandomSeed : public Action
+{
+private:
+	std::optional<RandomStream> stream;
+	std::optional<uint64_t> seed;
+
+public:
+	ActRandomSeed(std::optional<RandomStream> stream_, std::optional<uint64_t> seed_) noexcept
+		: stream(stream_), seed(seed_) {}
+
+	bool execute(Game& game) override
+	{
+		if (seed.has_value() == false)
+		{
+			Random::seed();
+		}
+		else if (stream.has_value() == false)
+		{
+			Random::seed(*seed);
+		}
+		else
+		{
+			Random::seed(*stream, *seed);
+		}
+		return true;
+	}
+};
+
 class ActRandom : public Action
 {
 private:
 	float percentage;
 	std::shared_ptr<Action> action1;
 	std::shared_ptr<Action> action2;
+	RandomStream stream;
 
 public:
 	ActRandom(float percentage_, const std::shared_ptr<Action>& action1_,
-		const std::shared_ptr<Action>& action2_) noexcept
-		: percentage(percentage_), action1(action1_), action2(action2_) {}
+		const std::shared_ptr<Action>& action2_,
+		RandomStream stream_ = RandomStream::Default) noexcept
+		: percentage(percentage_), action1(action1_), action2(action2_), stream(stream_) {}
 
 	bool execute(Game& game) override
 	{
-		if (Random::getf<float>() < percentage)
+		if (Random::getf<float>(stream) < percentage)
 		{
 			if (action1 != nullptr)
 			{
@@ -13,12 +13,13 @@ private:
 	std::string id;
 	Variable volume;
 	sf::Time seek;
+	int priority;
 	bool unique;
 
 public:
 	ActSoundLoadPlay(const std::string_view file_, const Variable& volume_,
-		sf::Time seek_, bool unique_) : file(file_), volume(volume_),
-		seek(seek_), unique(unique_)
+		sf::Time seek_, bool unique_, int priority_) : file(file_), volume(volume_),
+		seek(seek_), priority(priority_), unique(unique_)
 	{
 		Parser::getIdFromFile(file_, id);
 	}
@@ -33,7 +34,6 @@ public:
 		}
 		if (sndBuffer != nullptr)
 		{
-			sf::Sound sound(*sndBuffer);
 			auto vol = game.getVarOrProp<int64_t, unsigned>(volume, game.SoundVolume());
 			if (vol > 0)
 			{
@@ -41,8 +41,7 @@ public:
 				{
 					vol = 100;
 				}
-				sound.setVolume((float)vol);
-				game.Resources().addPlayingSound(sound, unique, seek);
+				game.Resources().addPlayingSound(*sndBuffer, (float)vol, unique, seek, priority);
 			}
 		}
 		return true;
@@ -55,19 +54,19 @@ private:
 	std::string id;
 	Variable volume;
 	sf::Time seek;
+	int priority;
 	bool unique;
 
 public:
 	ActSoundPlay(const std::string_view id_, const Variable& volume_,
-		sf::Time seek_, bool unique_) : id(id_), volume(volume_),
-		seek(seek_), unique(unique_) {}
+		sf::Time seek_, bool unique_, int priority_) : id(id_), volume(volume_),
+		seek(seek_), priority(priority_), unique(unique_) {}
 
 	bool execute(Game& game) override
 	{
 		auto sndBuffer = game.Resources().getSoundBuffer(id);
 		if (sndBuffer != nullptr)
 		{
-			sf::Sound sound(*sndBuffer);
 			auto vol = game.getVarOrProp<int64_t, unsigned>(volume, game.SoundVolume());
 			if (vol > 0)
 			{
@@ -75,8 +74,7 @@ public:
 				{
 					vol = 100;
 				}
-				sound.setVolume((float)vol);
-				game.Resources().addPlayingSound(sound, unique, seek);
+				game.Resources().addPlayingSound(*sndBuffer, (float)vol, unique, seek, priority);
 			}
 		}
 		return true;
@@ -1,5 +1,6 @@
 #include "BaseAnimation.h"
 #include "SFML/CompositeSprite.h"
+#include "Utils/Profiler.h"
 
 BaseAnimation::BaseAnimation(const std::shared_ptr<TexturePack>& texturePack_, bool pause_)
 	: texturePack(texturePack_), pause(pause_)
@@ -194,6 +195,9 @@ bool BaseAnimation::update(sf::Time elapsedTime_) noexcept
 
 bool BaseAnimation::updateTexture(CompositeSprite& sprite, bool& absoluteOffset) const
 {
+	PROFILE_ZONE("BaseAnimation::updateTexture");
+	PROFILE_COUNT(ProfilerCounter::TextureFetches);
+
 	if (texturePack == nullptr)
 	{
 		return false;
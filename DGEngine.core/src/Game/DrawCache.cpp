@@ -0,0 +1,58 @@
+#include "DrawCache.h"
+#include <cmath>
+#include <SFML/Graphics/Sprite.hpp>
+#include "UIObject.h"
+
+bool DrawCache::draw(const UIObject& obj, sf::RenderTarget& target,
+	const std::function<void(sf::RenderTarget&)>& drawFunc)
+{
+	size_t hash = 0;
+	if (obj.getDrawHash(hash) == false)
+	{
+		texture.reset();
+		valid = false;
+		return false;
+	}
+
+	auto drawSize = obj.Size();
+	const auto& objDrawPos = obj.DrawPosition();
+	sf::Vector2f pos(std::floor(objDrawPos.x), std::floor(objDrawPos.y));
+	sf::Vector2u size(
+		(unsigned)std::max(0.f, std::ceil(objDrawPos.x + drawSize.x - pos.x)),
+		(unsigned)std::max(0.f, std::ceil(objDrawPos.y + drawSize.y - pos.y)));
+	if (size.x == 0 || size.y == 0)
+	{
+		return true;
+	}
+
+	if (valid == false ||
+		hash != drawHash ||
+		pos != drawPosition ||
+		texture == nullptr ||
+		texture->getSize() != size)
+	{
+		if (texture == nullptr || texture->getSize() != size)
+		{
+			texture = std::make_unique<sf::RenderTexture>();
+			if (texture->create(size.x, size.y) == false)
+			{
+				texture.reset();
+				valid = false;
+				return false;
+			}
+		}
+		texture->setView(sf::View(sf::FloatRect(pos, sf::Vector2f(size))));
+		texture->clear(sf::Color::Transparent);
+		drawFunc(*texture);
+		texture->display();
+		drawHash = hash;
+		drawPosition = pos;
+		valid = true;
+	}
+
+	// the texture holds premultiplied colors after drawing with alpha blending into a transparent target.
+	sf::Sprite sprite(texture->getTexture());
+	sprite.setPosition(pos);
+	target.draw(sprite, sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha));
+	return true;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+class UIObject;
+
+// renders a UIObject into a texture and draws the texture until the object changes.
+class DrawCache
+{
+private:
+	std::unique_ptr<sf::RenderTexture> texture;
+	sf::Vector2f drawPosition;
+	size_t drawHash{ 0 };
+	bool valid{ false };
+
+public:
+	void invalidate() noexcept { valid = false; }
+
+	// draws obj's area from the cache, calling drawFunc to render it again if obj changed.
+	// returns false if obj can't be cached and must be drawn directly.
+	bool draw(const UIObject& obj, sf::RenderTarget& target,
+		const std::function<void(sf::RenderTarget&)>& drawFunc);
+};
@@ -7,8 +7,7 @@ void BitmapButton::update(Game& game)
 	{
 		return;
 	}
-	auto contains = sprite.getGlobalBounds().contains(game.MousePositionf());
-	Button::updateEvents(game, contains);
+	Button::updateEvents(game, sprite.getGlobalBounds());
 }
 
 bool BitmapButton::getProperty(const std::string_view prop, Variable& var) const
@@ -344,6 +344,24 @@ void Button::updateEvents(Game& game, bool contains)
 	}
 }
 
+void Button::updateEvents(Game& game, const sf::FloatRect& bounds)
+{
+	auto& hitIndex = game.HitIndex();
+	hitIndex.visit(this, bounds);
+	auto contains = (hitIndex.getTopHit() == this);
+	if (contains != hovered &&
+		hitIndex.TopHitChanged() == true)
+	{
+		// the top-most button changed, maybe under a still pointer
+		onHover(game, contains);
+	}
+	if (contains == false && isIdle() == true)
+	{
+		return;
+	}
+	updateEvents(game, contains);
+}
+
 bool Button::getProperty(const std::string_view prop, Variable& var) const
 {
 	if (prop.size() <= 1)
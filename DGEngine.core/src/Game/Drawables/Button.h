@@ -5,6 +5,7 @@
 #include "Game/UIObject.h"
 #include <memory>
 #include "SFML/Audio/SoundBuffer.hpp"
+#include "SFML/Graphics/Rect.hpp"
 #include "SFML/System/Clock.hpp"
 
 class Button : public virtual ActionQueryable, public virtual UIObject
@@ -41,7 +42,16 @@ protected:
 	void onTouchBegan(Game& game, bool contains);
 	void onTouchEnded(Game& game, bool contains);
 
+	bool isIdle() const noexcept
+	{
+		return hovered == false && beingDragged == false &&
+			wasLeftClicked == false && wasRightClicked == false;
+	}
+
 	void updateEvents(Game& game, bool contains);
+	// visits the game's hit index and only dispatches events if the button is
+	// the top-most one under the pointer or has a hover leave, release or drag pending.
+	void updateEvents(Game& game, const sf::FloatRect& bounds);
 
 public:
 	InputEventType getCaptureInputEvents() const noexcept { return captureInputEvents; }
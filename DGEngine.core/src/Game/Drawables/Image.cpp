@@ -119,6 +119,16 @@ void Image::draw(const Game& game, sf::RenderTarget& target) const
 	}
 }
 
+bool Image::getDrawHash(size_t& hash) const
+{
+	hashCombine(hash, visible);
+	if (visible == true)
+	{
+		sprite.getDrawHash(hash);
+	}
+	return true;
+}
+
 bool Image::getProperty(const std::string_view prop, Variable& var) const
 {
 	if (prop.size() <= 1)
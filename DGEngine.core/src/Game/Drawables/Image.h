@@ -73,5 +73,7 @@ public:
 	void Size(const sf::Vector2f& size) override;
 	void draw(const Game& game, sf::RenderTarget& target) const override;
 
+	bool getDrawHash(size_t& hash) const override;
+
 	bool getProperty(const std::string_view prop, Variable& var) const override;
 };
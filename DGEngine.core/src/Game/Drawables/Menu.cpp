@@ -252,16 +252,45 @@ void Menu::calculatePositions()
 	}
 }
 
+void Menu::drawItems(const Game& game, sf::RenderTarget& target) const
+{
+	for (size_t i = start; i < end; i++)
+	{
+		items[i]->draw(game, target);
+	}
+}
+
 void Menu::draw(const Game& game, sf::RenderTarget& target) const
 {
 	if (visible == false)
 	{
 		return;
 	}
+	if (cacheDraw == true &&
+		drawCache.draw(*this, target, [&](sf::RenderTarget& cacheTarget) { drawItems(game, cacheTarget); }) == true)
+	{
+		return;
+	}
+	drawItems(game, target);
+}
+
+bool Menu::getDrawHash(size_t& hash) const
+{
+	hashCombine(hash, visible);
+	if (visible == false)
+	{
+		return true;
+	}
+	hashCombine(hash, start);
+	hashCombine(hash, end);
 	for (size_t i = start; i < end; i++)
 	{
-		items[i]->draw(game, target);
+		if (items[i]->getDrawHash(hash) == false)
+		{
+			return false;
+		}
 	}
+	return true;
 }
 
 void Menu::updateSize(const Game& game)
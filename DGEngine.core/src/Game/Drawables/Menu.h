@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Game/ActionQueryable.h"
+#include "Game/DrawCache.h"
 #include "StringButton.h"
 #include <vector>
 
@@ -24,6 +25,10 @@ private:
 	std::shared_ptr<Action> scrollDownAction;
 	std::shared_ptr<Action> scrollUpAction;
 	bool visible{ true };
+	bool cacheDraw{ false };
+	mutable DrawCache drawCache;
+
+	void drawItems(const Game& game, sf::RenderTarget& target) const;
 
 public:
 	void updateVisibleItems() noexcept;
@@ -60,9 +65,15 @@ public:
 	bool Visible() const noexcept override { return visible; }
 	void Visible(bool visible_) noexcept override { visible = visible_; }
 
+	// draw into a texture that is only redrawn when an item changes.
+	bool CacheDraw() const noexcept { return cacheDraw; }
+	void CacheDraw(bool cache) noexcept { cacheDraw = cache; drawCache.invalidate(); }
+
 	void draw(const Game& game, sf::RenderTarget& target) const override;
 
 	void update(Game& game) override;
 
+	bool getDrawHash(size_t& hash) const override;
+
 	bool getProperty(const std::string_view prop, Variable& var) const override;
 };
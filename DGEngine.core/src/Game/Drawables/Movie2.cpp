@@ -100,5 +100,24 @@ bool Movie::getProperty(const std::string_view prop, Variable& var) const
 		return false;
 	}
 	auto props = Utils::splitStringIn2(prop, '.');
-	return getUIObjProp(str2int16(props.first), props.second, var);
+	auto propHash = str2int16(props.first);
+	switch (propHash)
+	{
+#ifndef DGENGINE_MOVIE_STUB
+	case str2int16("droppedFrames"):
+		var = Variable((int64_t)movie.getDroppedFrameCount());
+		break;
+	case str2int16("lateFrames"):
+		var = Variable((int64_t)movie.getLateFrameCount());
+		break;
+#else
+	case str2int16("droppedFrames"):
+	case str2int16("lateFrames"):
+		var = Variable((int64_t)0);
+		break;
+#endif
+	default:
+		return getUIObjProp(propHash, props.second, var);
+	}
+	return true;
 }
@@ -141,12 +141,8 @@ bool Panel::draw(const Game& game, sf::RenderTarget& target, const sf::FloatRect
 	return hasDrawn;
 }
 
-void Panel::draw(const Game& game, sf::RenderTarget& target) const
+void Panel::drawDrawables(const Game& game, sf::RenderTarget& target) const
 {
-	if (visible == false)
-	{
-		return;
-	}
 	for (const auto& drawable : drawables)
 	{
 		if (auto obj = drawable.lock())
@@ -156,6 +152,20 @@ void Panel::draw(const Game& game, sf::RenderTarget& target) const
 	}
 }
 
+void Panel::draw(const Game& game, sf::RenderTarget& target) const
+{
+	if (visible == false)
+	{
+		return;
+	}
+	if (cacheDraw == true &&
+		drawCache.draw(*this, target, [&](sf::RenderTarget& cacheTarget) { drawDrawables(game, cacheTarget); }) == true)
+	{
+		return;
+	}
+	drawDrawables(game, target);
+}
+
 void Panel::update(Game& game)
 {
 	if (visible == false)
@@ -181,6 +191,26 @@ void Panel::update(Game& game)
 	}
 }
 
+bool Panel::getDrawHash(size_t& hash) const
+{
+	hashCombine(hash, visible);
+	if (visible == false)
+	{
+		return true;
+	}
+	for (const auto& drawable : drawables)
+	{
+		if (auto obj = drawable.lock())
+		{
+			if (obj->getDrawHash(hash) == false)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
 bool Panel::getProperty(const std::string_view prop, Variable& var) const
 {
 	if (prop.size() <= 1)
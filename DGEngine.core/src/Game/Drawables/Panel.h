@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Game/DrawCache.h"
 #include "Game/UIObject.h"
 #include <memory>
 #include <vector>
@@ -15,10 +16,14 @@ private:
 	bool visible{ true };
 	bool relativePositions{ true };
 	mutable bool sizePosNeedsUpdate{ true };
+	bool cacheDraw{ false };
+	mutable DrawCache drawCache;
 
 	// calculate the draw position/size based on all its children's draw positions/sizes
 	void updateDrawPositionAndSize() const;
 
+	void drawDrawables(const Game& game, sf::RenderTarget& target) const;
+
 public:
 	Panel(bool relativePositions_) : relativePositions(relativePositions_) {}
 
@@ -39,10 +44,16 @@ public:
 	bool Visible() const noexcept override { return visible; }
 	void Visible(bool visible_) noexcept override { visible = visible_; }
 
+	// draw into a texture that is only redrawn when a child changes.
+	bool CacheDraw() const noexcept { return cacheDraw; }
+	void CacheDraw(bool cache) noexcept { cacheDraw = cache; drawCache.invalidate(); }
+
 	bool draw(const Game& game, sf::RenderTarget& target,
 		const sf::FloatRect& visibleRect) const;
 	void draw(const Game& game, sf::RenderTarget& target) const override;
 	void update(Game& game) override;
 
+	bool getDrawHash(size_t& hash) const override;
+
 	bool getProperty(const std::string_view prop, Variable& var) const override;
 };
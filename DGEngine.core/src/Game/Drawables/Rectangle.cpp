@@ -13,6 +13,30 @@ void Rectangle::updateSize(const Game& game)
 	setSize(size);
 }
 
+bool Rectangle::getDrawHash(size_t& hash) const
+{
+	hashCombine(hash, visible);
+	if (visible == true)
+	{
+		const auto& pos = getPosition();
+		const auto& size = getSize();
+		const auto& rect = getTextureRect();
+		hashCombine(hash, pos.x);
+		hashCombine(hash, pos.y);
+		hashCombine(hash, size.x);
+		hashCombine(hash, size.y);
+		hashCombine(hash, getFillColor().toInteger());
+		hashCombine(hash, getOutlineColor().toInteger());
+		hashCombine(hash, getOutlineThickness());
+		hashCombine(hash, getTexture());
+		hashCombine(hash, rect.left);
+		hashCombine(hash, rect.top);
+		hashCombine(hash, rect.width);
+		hashCombine(hash, rect.height);
+	}
+	return true;
+}
+
 bool Rectangle::getProperty(const std::string_view prop, Variable& var) const
 {
 	if (prop.size() <= 1)
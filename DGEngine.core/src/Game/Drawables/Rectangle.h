@@ -33,5 +33,7 @@ public:
 		}
 	}
 
+	bool getDrawHash(size_t& hash) const override;
+
 	bool getProperty(const std::string_view prop, Variable& var) const override;
 };
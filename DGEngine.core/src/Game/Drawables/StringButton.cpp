@@ -27,8 +27,7 @@ void StringButton::update(Game& game)
 	{
 		return;
 	}
-	auto contains = BindableText::getGlobalBounds().contains(game.MousePositionf());
-	Button::updateEvents(game, contains);
+	Button::updateEvents(game, BindableText::getGlobalBounds());
 }
 
 bool StringButton::getProperty(const std::string_view prop, Variable& var) const
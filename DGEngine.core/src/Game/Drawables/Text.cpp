@@ -36,3 +36,20 @@ void Text::update(Game& game)
 		}
 	}
 }
+
+bool Text::getDrawHash(size_t& hash) const
+{
+	auto visible = text->Visible();
+	hashCombine(hash, visible);
+	if (visible == true)
+	{
+		const auto& pos = text->DrawPosition();
+		auto size = text->Size();
+		hashCombine(hash, pos.x);
+		hashCombine(hash, pos.y);
+		hashCombine(hash, size.x);
+		hashCombine(hash, size.y);
+		hashCombine(hash, drawVersion);
+	}
+	return true;
+}
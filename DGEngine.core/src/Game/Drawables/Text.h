@@ -9,6 +9,8 @@ protected:
 	std::unique_ptr<DrawableText> text;
 	std::shared_ptr<Action> changeAction;
 	bool triggerOnChange{ false };
+	// incremented when the text or its style changes.
+	uint32_t drawVersion{ 0 };
 
 public:
 	Text(std::unique_ptr<DrawableText> text_) : text(std::move(text_)) {}
@@ -24,22 +26,30 @@ public:
 	}
 	Text& operator=(Text&& other) = delete;
 
-	auto getDrawableText() noexcept { return text.get(); }
+	// the text can be changed using the returned pointer, so it's treated as changed.
+	auto getDrawableText() noexcept { drawVersion++; return text.get(); }
 
 	auto getText() const { return text->getText(); }
-	void setText(const std::string& text_) { triggerOnChange = text->setText(text_); }
+	void setText(const std::string& text_)
+	{
+		triggerOnChange = text->setText(text_);
+		if (triggerOnChange == true)
+		{
+			drawVersion++;
+		}
+	}
 
 	auto getLocalBounds() const { return text->getLocalBounds(); }
 	auto getGlobalBounds() const { return text->getGlobalBounds(); }
 
 	auto getLineCount() const { return text->getLineCount(); }
-	void setColor(const sf::Color& color) { text->setColor(color); }
+	void setColor(const sf::Color& color) { text->setColor(color); drawVersion++; }
 
-	void setHorizontalAlign(const HorizontalAlign align) { text->setHorizontalAlign(align); }
-	void setVerticalAlign(const VerticalAlign align) { text->setVerticalAlign(align); }
+	void setHorizontalAlign(const HorizontalAlign align) { text->setHorizontalAlign(align); drawVersion++; }
+	void setVerticalAlign(const VerticalAlign align) { text->setVerticalAlign(align); drawVersion++; }
 
-	void setHorizontalSpaceOffset(int offset) { text->setHorizontalSpaceOffset(offset); }
-	void setVerticalSpaceOffset(int offset) { text->setVerticalSpaceOffset(offset); }
+	void setHorizontalSpaceOffset(int offset) { text->setHorizontalSpaceOffset(offset); drawVersion++; }
+	void setVerticalSpaceOffset(int offset) { text->setVerticalSpaceOffset(offset); drawVersion++; }
 
 	HorizontalAlign getHorizontalAlign() const { return text->getHorizontalAlign(); }
 	VerticalAlign getVerticalAlign() const { return text->getVerticalAlign(); }
@@ -67,6 +77,8 @@ public:
 
 	void update(Game& game) override;
 
+	bool getDrawHash(size_t& hash) const override;
+
 	bool getProperty(const std::string_view prop, Variable& var) const override
 	{
 		return text->getProperty(prop, var);
@@ -1,5 +1,6 @@
 #include "EventManager.h"
 #include "Event.h"
+#include "Utils/Profiler.h"
 
 void EventManager::tryAddBack(const std::shared_ptr<Action>& action)
 {
@@ -87,6 +88,8 @@ void EventManager::resetTime(const std::string& id)
 
 void EventManager::update(Game& game)
 {
+	PROFILE_ZONE("EventManager::update");
+
 	for (auto it = events.begin(); it != events.end();)
 	{
 		auto evt = it->get();
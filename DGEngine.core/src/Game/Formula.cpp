@@ -1,10 +1,24 @@
 #include "Formula.h"
 #include <charconv>
 #include <cmath>
-#include "Utils/Random.h"
 #include "Utils/StringHash.h"
 #include "Utils/Utils.h"
 
+namespace
+{
+	thread_local bool useCosmeticStream = false;
+}
+
+Formula::CosmeticScope::CosmeticScope() noexcept : oldValue(useCosmeticStream)
+{
+	useCosmeticStream = true;
+}
+
+Formula::CosmeticScope::~CosmeticScope()
+{
+	useCosmeticStream = oldValue;
+}
+
 Formula::FormulaIterator::FormulaIterator(const std::string_view formula_,
 	bool getStringRefs) : formula(formula_)
 {
@@ -108,7 +122,7 @@ void Formula::FormulaElementIterator::next()
 	std::get<FormulaIterator>(it).next();
 }
 
-Formula::Formula(const std::string_view formula)
+Formula::Formula(const std::string_view formula, RandomStream stream_) : stream(stream_)
 {
 	// create internal formula
 	FormulaIterator it(formula, false);
@@ -319,8 +333,12 @@ void Formula::skipTokens(FormulaElementIterator& it)
 }
 
 double Formula::eval(FormulaElementIterator& it, const Queryable* queryA,
-	const Queryable* queryB, int32_t randomNum)
+	const Queryable* queryB, int32_t randomNum, RandomStream randomStream)
 {
+	if (useCosmeticStream == true)
+	{
+		randomStream = RandomStream::Cosmetic;
+	}
 	double val = 0.0;
 	FormulaOp currUnaryOp = FormulaOp::None;
 	FormulaOp currBinaryOp = FormulaOp::Add;
@@ -373,7 +391,7 @@ double Formula::eval(FormulaElementIterator& it, const Queryable* queryA,
 			case FormulaOp::LeftBracket:
 			{
 				it.next();
-				val2 = eval(it, queryA, queryB, randomNum);
+				val2 = eval(it, queryA, queryB, randomNum, randomStream);
 				break;
 			}
 			case FormulaOp::RightBracket:
@@ -451,11 +469,11 @@ double Formula::eval(FormulaElementIterator& it, const Queryable* queryA,
 				{
 					if (currUnaryOp == FormulaOp::Rand)
 					{
-						val2 = (double)Random::get((uint32_t)val2);
+						val2 = (double)Random::get(randomStream, (uint32_t)val2);
 					}
 					else
 					{
-						val2 = Random::getf(val2);
+						val2 = Random::getf(randomStream, val2);
 					}
 				}
 				else
@@ -483,7 +501,7 @@ double Formula::eval(FormulaElementIterator& it, const Queryable* queryA,
 			{
 				if (val2 > 0.0)
 				{
-					val2 = std::round(RandomNormal::getRange(val2));
+					val2 = std::round(RandomNormal::getRange(randomStream, val2));
 				}
 				else
 				{
@@ -609,25 +627,25 @@ double Formula::evalMinMax(const Queryable* queryA,
 	{
 		randomNum = Utils::strtonumber<int32_t>(minMaxNum);
 	}
-	return eval(it, queryA, queryB, randomNum);
+	return eval(it, queryA, queryB, randomNum, stream);
 }
 
 double Formula::eval(const Queryable& queryA, const Queryable& queryB, int32_t randomNum) const
 {
 	FormulaElementIterator it(elements);
-	return eval(it, &queryA, &queryB, randomNum);
+	return eval(it, &queryA, &queryB, randomNum, stream);
 }
 
 double Formula::eval(const Queryable& query, int32_t randomNum) const
 {
 	FormulaElementIterator it(elements);
-	return eval(it, &query, &query, randomNum);
+	return eval(it, &query, &query, randomNum, stream);
 }
 
 double Formula::eval(int32_t randomNum) const
 {
 	FormulaElementIterator it(elements);
-	return eval(it, nullptr, nullptr, randomNum);
+	return eval(it, nullptr, nullptr, randomNum, stream);
 }
 
 double Formula::eval(const Queryable& queryA, const Queryable& queryB,
@@ -649,35 +667,55 @@ double Formula::eval(const std::string_view minMaxNum) const
 double Formula::evalString(const std::string_view formula, int32_t randomNum)
 {
 	FormulaElementIterator it(formula);
-	return eval(it, nullptr, nullptr, randomNum);
+	return eval(it, nullptr, nullptr, randomNum, RandomStream::Default);
 }
 
 double Formula::evalString(const std::string_view formula,
 	const Queryable& query, int32_t randomNum)
 {
 	FormulaElementIterator it(formula);
-	return eval(it, &query, &query, randomNum);
+	return eval(it, &query, &query, randomNum, RandomStream::Default);
 }
 
 double Formula::evalString(const std::string_view formula,
 	const Queryable* query, int32_t randomNum)
 {
 	FormulaElementIterator it(formula);
-	return eval(it, query, query, randomNum);
+	return eval(it, query, query, randomNum, RandomStream::Default);
 }
 
 double Formula::evalString(const std::string_view formula,
 	const Queryable& queryA, const Queryable& queryB, int32_t randomNum)
 {
 	FormulaElementIterator it(formula);
-	return eval(it, &queryA, &queryB, randomNum);
+	return eval(it, &queryA, &queryB, randomNum, RandomStream::Default);
 }
 
 double Formula::evalString(const std::string_view formula,
 	const Queryable* queryA, const Queryable* queryB, int32_t randomNum)
 {
 	FormulaElementIterator it(formula);
-	return eval(it, queryA, queryB, randomNum);
+	return eval(it, queryA, queryB, randomNum, RandomStream::Default);
+}
+
+bool Formula::hasRandom() const noexcept
+{
+	for (const auto& elem : elements)
+	{
+		if (std::holds_alternative<FormulaOp>(elem) == true)
+		{
+			switch (std::get<FormulaOp>(elem))
+			{
+			case FormulaOp::Rand:
+			case FormulaOp::RandFloat:
+			case FormulaOp::RandNormalDist:
+				return true;
+			default:
+				break;
+			}
+		}
+	}
+	return false;
 }
 
 std::string Formula::toString() const
@@ -5,6 +5,7 @@
 #include <string_view>
 #include <variant>
 #include <vector>
+#include "Utils/Random.h"
 
 // use brackets to force order
 // ex: 2 + 2 * 4 = 16
@@ -81,6 +82,7 @@ private:
 	using FormulaElement = std::variant<FormulaOp, double, std::string, std::string_view>;
 
 	std::vector<FormulaElement> elements;
+	RandomStream stream{ RandomStream::Default };
 
 	struct VectorIterator
 	{
@@ -129,17 +131,55 @@ private:
 	static void skipTokens(FormulaElementIterator& it);
 
 	static double eval(FormulaElementIterator& it, const Queryable* queryA,
-		const Queryable* queryB, int32_t randomNum);
+		const Queryable* queryB, int32_t randomNum, RandomStream randomStream);
 
 	double evalMinMax(const Queryable* queryA,
 		const Queryable* queryB, const std::string_view minMaxNum) const;
 
 public:
+	// while alive, formulas evaluated in this thread use the cosmetic stream,
+	// so showing a value in the UI (descriptions) doesn't change the next roll.
+	class CosmeticScope
+	{
+	private:
+		bool oldValue;
+
+	public:
+		CosmeticScope() noexcept;
+		~CosmeticScope();
+		CosmeticScope(const CosmeticScope&) = delete;
+		CosmeticScope& operator=(const CosmeticScope&) = delete;
+	};
+
 	Formula() noexcept {}
-	Formula(const std::string_view formula);
+	// stream - random stream used by :rnd, :rndf and :rndn
+	Formula(const std::string_view formula, RandomStream stream_ = RandomStream::Default);
 
 	bool empty() const noexcept { return elements.empty(); }
 
+	RandomStream Stream() const noexcept { return stream; }
+	void Stream(RandomStream stream_) noexcept { stream = stream_; }
+
+	// true if the formula uses random numbers (:rnd, :rndf, :rndn).
+	bool hasRandom() const noexcept;
+
+	// calls fn with the name of every variable used in the formula.
+	template <class Fn>
+	void forEachVariable(Fn fn) const
+	{
+		for (const auto& elem : elements)
+		{
+			if (std::holds_alternative<std::string>(elem) == true)
+			{
+				fn(std::string_view(std::get<std::string>(elem)));
+			}
+			else if (std::holds_alternative<std::string_view>(elem) == true)
+			{
+				fn(std::get<std::string_view>(elem));
+			}
+		}
+	}
+
 	// randomNum - random number to use
 	// randomNum > 0 -> use given number (ex: :rnd(10) = randomNum)
 	// randomNum = 0 -> disabled (ex: :rnd(10) = 0-9)
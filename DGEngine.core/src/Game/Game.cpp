@@ -8,6 +8,7 @@
 #include <SFML/Audio/SoundFileFactory.hpp>
 #include "SFML/SFMLUtils.h"
 #include "SFML/Wave2.h"
+#include "Utils/Profiler.h"
 #include "Utils/ReverseIterable.h"
 #include "Utils/StringHash.h"
 
@@ -278,19 +279,44 @@ void Game::play()
 		return;
 	}
 
-	updateMousePosition();
+	bool replaying = inputRecorder.isReplaying();
+	if (replaying == true)
+	{
+		// replays run as fast as possible in a hidden window
+		window.setVisible(false);
+		window.setFramerateLimit(0);
+		window.setVerticalSyncEnabled(false);
+	}
+
+	auto mousePos = sf::Mouse::getPosition(window);
+	inputRecorder.begin(mousePos);
+	updateMousePosition(mousePos);
 	sf::Clock frameClock;
 
 	while (window.isOpen() == true)
 	{
+		PROFILE_NEW_FRAME();
+
 		if (fullScreen == false)
 		{
 			position.emplace(window.getPosition());
 		}
 
-		processEvents();
-
-		elapsedTime = frameClock.restart();
+		if (replaying == true)
+		{
+			if (inputRecorder.nextFrame(elapsedTime) == false)
+			{
+				break;
+			}
+			frameClock.restart();
+			processEvents();
+		}
+		else
+		{
+			processEvents();
+			elapsedTime = frameClock.restart();
+			inputRecorder.endFrame(elapsedTime);
+		}
 		totalElapsedTime += elapsedTime;
 
 		updateEvents();
@@ -302,7 +328,53 @@ void Game::play()
 			update();
 			draw();
 		}
+
+		if (replaying == true)
+		{
+			inputRecorder.addFrameTime(elapsedTime, frameClock.getElapsedTime());
+		}
+	}
+
+	inputRecorder.end(getStateChecksum());
+}
+
+uint64_t Game::getStateChecksum() const
+{
+	// variables are added in any order
+	uint64_t checksum = 0;
+	for (const auto& [key, value] : variableManager.getVariables())
+	{
+		size_t hash = value.index();
+		hashCombine(hash, key);
+		std::visit([&hash](const auto& val)
+		{
+			using T = std::decay_t<decltype(val)>;
+			if constexpr (std::is_same_v<T, std::string> || std::is_arithmetic_v<T>)
+			{
+				hashCombine(hash, val);
+			}
+			else
+			{
+				std::apply([&hash](const auto&... elems) { (hashCombine(hash, elems), ...); }, val);
+			}
+		}, value);
+		checksum += hash;
+	}
+	return checksum;
+}
+
+bool Game::pollEvent(sf::Event& evt)
+{
+	if (inputRecorder.isReplaying() == true)
+	{
+		return inputRecorder.pollEvent(evt);
+	}
+	if (window.pollEvent(evt) == false)
+	{
+		return false;
 	}
+	inputRecorder.addEvent(evt);
+	return true;
 }
 
 void Game::processEvents()
@@ -315,7 +387,12 @@ void Game::processEvents()
 	textEntered = false;
 
 	sf::Event evt;
-	while (window.pollEvent(evt))
+	if (inputRecorder.isReplaying() == true)
+	{
+		// only recorded events are processed while replaying
+		while (window.pollEvent(evt)) {}
+	}
+	while (pollEvent(evt))
 	{
 		switch (evt.type)
 		{
@@ -365,7 +442,7 @@ void Game::processEvents()
 			break;
 		}
 	}
-	resourceManager.updateActiveInputEvents();
+	resourceManager.updateActiveInputEvents(inputRecorder);
 }
 
 void Game::onClosed()
@@ -665,6 +742,12 @@ void Game::setMousePosition(sf::Vector2i mousePos)
 
 void Game::updateMousePosition()
 {
+	// recordings use the position of the last mouse event, which is what gets replayed
+	if (inputRecorder.getMode() != InputRecorder::Mode::None)
+	{
+		updateMousePosition(inputRecorder.MousePosition());
+		return;
+	}
 	updateMousePosition(sf::Mouse::getPosition(window));
 }
 
@@ -708,6 +791,13 @@ bool Game::drawLoadingScreen()
 
 void Game::update()
 {
+	PROFILE_ZONE("Game::update");
+
+	if (paused == false)
+	{
+		hitIndex.update(mousePositionf);
+	}
+
 	for (auto& res : reverse(resourceManager))
 	{
 		if ((int)(res.ignore & IgnoreResource::Update) == 0)
@@ -822,6 +912,8 @@ void Game::drawWindow()
 
 void Game::draw()
 {
+	PROFILE_ZONE("Game::draw");
+
 	window.clear();
 	gameTexture.clear();
 
@@ -977,9 +1069,7 @@ void Game::KeepAR(bool keepAR_)
 
 void Game::addPlayingSound(const sf::SoundBuffer& obj)
 {
-	sf::Sound sound(obj);
-	sound.setVolume((float)soundVolume);
-	resourceManager.addPlayingSound(sound);
+	resourceManager.addPlayingSound(obj, (float)soundVolume);
 }
 
 void Game::addPlayingSound(const sf::SoundBuffer* obj)
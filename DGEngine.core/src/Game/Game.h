@@ -6,12 +6,14 @@
 #include "FadeInOut.h"
 #include "GameInputEventManager.h"
 #include "InputEvent.h"
+#include "InputRecorder.h"
 #include <optional>
 #include "Queryable.h"
 #include "ResourceManager.h"
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include "UIHitIndex.h"
 #include "VariableManager.h"
 #include "VarOrQueryObject.h"
 #include <vector>
@@ -109,6 +111,8 @@ protected:
 	EventManager eventManager;
 	VariableManager variableManager;
 	GameInputEventManager gameInputEventManager;
+	InputRecorder inputRecorder;
+	UIHitIndex hitIndex;
 
 	std::unique_ptr<LoadingScreen> loadingScreen;
 	FadeInOut fadeObj;
@@ -139,6 +143,7 @@ protected:
 
 	void updateMousePosition(const sf::Vector2i mousePos);
 	void updateEvents();
+	bool pollEvent(sf::Event& evt);
 	void drawCursor();
 	void drawUI();
 	void update();
@@ -235,11 +240,17 @@ public:
 	void clearTouchMoved() noexcept { touchMoved = false; }
 	void clearTouchEnded() noexcept { touchEnded = false; }
 
+	auto& HitIndex() noexcept { return hitIndex; }
+	auto& HitIndex() const noexcept { return hitIndex; }
+
 	void clearInputEvents(InputEventType e) noexcept;
 
 	auto& GameInputEvents() noexcept { return gameInputEventManager; }
 	auto& GameInputEvents() const noexcept { return gameInputEventManager; }
 
+	auto& Recorder() noexcept { return inputRecorder; }
+	auto& Recorder() const noexcept { return inputRecorder; }
+
 	void FrameRate(int frameRate_);
 	void FullScreen(bool fullScreen_);
 	void SmoothScreen(bool smooth_);
@@ -308,6 +319,9 @@ public:
 
 	void play();
 
+	// checksum of the game state that should be the same after replaying the same input.
+	virtual uint64_t getStateChecksum() const;
+
 	auto& Variables() noexcept { return variableManager; }
 	auto& Variables() const noexcept { return variableManager; }
 
@@ -7,6 +7,7 @@
 #include "Game/Utils/GameUtils.h"
 #include "Game/Utils/UIObjectUtils.h"
 #include "Game/Utils/VarUtils.h"
+#include "Utils/Profiler.h"
 #include "Utils/StringHash.h"
 #include "Utils/Utils.h"
 
@@ -256,6 +257,34 @@ bool GameQueryable::getGameProperty(const Game& game, const std::string_view pro
 	case str2int16("position"):
 		var = UIObjectUtils::getTuple2iProp(game.Position(), prop2);
 		break;
+	case str2int16("profiler"):
+	{
+		switch (str2int16(prop2))
+		{
+		case str2int16("allocations"):
+			var = Variable((int64_t)Profiler::getLastFrameCounter(ProfilerCounter::Allocations));
+			break;
+		case str2int16("drawCalls"):
+			var = Variable((int64_t)Profiler::getLastFrameCounter(ProfilerCounter::DrawCalls));
+			break;
+		case str2int16("enabled"):
+			var = Variable(Profiler::Enabled());
+			break;
+		case str2int16("frameTime"):
+			var = Variable(Profiler::getLastFrameTime());
+			break;
+		case str2int16("textureBinds"):
+			var = Variable((int64_t)Profiler::getLastFrameCounter(ProfilerCounter::TextureBinds));
+			break;
+		case str2int16("textureFetches"):
+			var = Variable((int64_t)Profiler::getLastFrameCounter(ProfilerCounter::TextureFetches));
+			break;
+		default:
+			var = Variable(Profiler::getLastFrameSummary());
+			break;
+		}
+		break;
+	}
 	case str2int16("refSize"):
 		var = UIObjectUtils::getTuple2iProp(game.RefSize(), prop2);
 		break;
@@ -0,0 +1,434 @@
+#include "InputRecorder.h"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include "Utils/Random.h"
+
+namespace
+{
+	constexpr std::array<char, 4> FileMagic{ 'D', 'G', 'I', 'R' };
+
+	enum class RecordTag : uint8_t
+	{
+		Frame,
+		End,
+		// more events of the previous frame (frames with more than MaxRecordEvents events)
+		FrameEvents
+	};
+
+	constexpr size_t MaxRecordEvents = UINT16_MAX;
+
+	// size of the event data saved for each event type (0 for events that aren't saved).
+	size_t getEventDataSize(sf::Event::EventType type) noexcept
+	{
+		switch (type)
+		{
+		case sf::Event::Closed:
+		case sf::Event::LostFocus:
+		case sf::Event::GainedFocus:
+			return 0;
+		case sf::Event::Resized:
+			return sizeof(sf::Event::SizeEvent);
+		case sf::Event::TextEntered:
+			return sizeof(sf::Event::TextEvent);
+		case sf::Event::KeyPressed:
+		case sf::Event::KeyReleased:
+			return sizeof(sf::Event::KeyEvent);
+		case sf::Event::MouseWheelScrolled:
+			return sizeof(sf::Event::MouseWheelScrollEvent);
+		case sf::Event::MouseButtonPressed:
+		case sf::Event::MouseButtonReleased:
+			return sizeof(sf::Event::MouseButtonEvent);
+		case sf::Event::MouseMoved:
+			return sizeof(sf::Event::MouseMoveEvent);
+		case sf::Event::TouchBegan:
+		case sf::Event::TouchMoved:
+		case sf::Event::TouchEnded:
+			return sizeof(sf::Event::TouchEvent);
+		default:
+			return 0;
+		}
+	}
+
+	// events that Game::processEvents doesn't handle aren't recorded.
+	bool isRecordedEvent(sf::Event::EventType type) noexcept
+	{
+		switch (type)
+		{
+		case sf::Event::MouseWheelMoved:
+		case sf::Event::MouseEntered:
+		case sf::Event::MouseLeft:
+		case sf::Event::JoystickButtonPressed:
+		case sf::Event::JoystickButtonReleased:
+		case sf::Event::JoystickMoved:
+		case sf::Event::JoystickConnected:
+		case sf::Event::JoystickDisconnected:
+		case sf::Event::SensorChanged:
+			return false;
+		default:
+			return type < sf::Event::Count;
+		}
+	}
+}
+
+void InputRecorder::write(const void* data, size_t size)
+{
+	recordFile.write((const char*)data, size);
+}
+
+bool InputRecorder::read(void* data, size_t size) noexcept
+{
+	if (replayPos + size > replayData.size())
+	{
+		replayPos = replayData.size();
+		return false;
+	}
+	std::memcpy(data, replayData.data() + replayPos, size);
+	replayPos += size;
+	return true;
+}
+
+void InputRecorder::writeEvent(const sf::Event& evt)
+{
+	auto type = (uint8_t)evt.type;
+	write(&type, sizeof(type));
+	// all event structs start at the union's address
+	write(&evt.size, getEventDataSize(evt.type));
+}
+
+bool InputRecorder::readEvent(sf::Event& evt) noexcept
+{
+	uint8_t type;
+	if (read(&type, sizeof(type)) == false ||
+		isRecordedEvent((sf::Event::EventType)type) == false)
+	{
+		return false;
+	}
+	evt = {};
+	evt.type = (sf::Event::EventType)type;
+	return read(&evt.size, getEventDataSize(evt.type));
+}
+
+void InputRecorder::updateInputState(const sf::Event& evt) noexcept
+{
+	switch (evt.type)
+	{
+	case sf::Event::KeyPressed:
+	case sf::Event::KeyReleased:
+	{
+		bool pressed = evt.type == sf::Event::KeyPressed;
+		if (evt.key.code >= 0 && evt.key.code < sf::Keyboard::KeyCount)
+		{
+			keys[evt.key.code] = pressed;
+		}
+		if (evt.key.scancode >= 0 && evt.key.scancode < sf::Keyboard::Scan::ScancodeCount)
+		{
+			scancodes[evt.key.scancode] = pressed;
+		}
+		break;
+	}
+	case sf::Event::MouseButtonPressed:
+	case sf::Event::MouseButtonReleased:
+	{
+		if (evt.mouseButton.button >= 0 && evt.mouseButton.button < sf::Mouse::ButtonCount)
+		{
+			mouseButtons[evt.mouseButton.button] = evt.type == sf::Event::MouseButtonPressed;
+		}
+		mousePosition = { evt.mouseButton.x, evt.mouseButton.y };
+		break;
+	}
+	case sf::Event::MouseWheelScrolled:
+		mousePosition = { evt.mouseWheelScroll.x, evt.mouseWheelScroll.y };
+		break;
+	case sf::Event::MouseMoved:
+		mousePosition = { evt.mouseMove.x, evt.mouseMove.y };
+		break;
+	case sf::Event::TouchBegan:
+	case sf::Event::TouchMoved:
+	case sf::Event::TouchEnded:
+		mousePosition = { evt.touch.x, evt.touch.y };
+		break;
+	case sf::Event::LostFocus:
+		keys.reset();
+		scancodes.reset();
+		mouseButtons.reset();
+		break;
+	default:
+		break;
+	}
+}
+
+bool InputRecorder::startRecording(const std::string_view filePath_)
+{
+	recordFile.open(std::string(filePath_), std::ios::binary | std::ios::trunc);
+	if (recordFile.is_open() == false)
+	{
+		return false;
+	}
+	mode = Mode::Record;
+	filePath = filePath_;
+	seeds.clear();
+	for (size_t i = 0; i < (size_t)RandomStream::Size; i++)
+	{
+		seeds.push_back(RandomGenerator::getSeed((RandomStream)i));
+	}
+	return true;
+}
+
+bool InputRecorder::startReplay(const std::string_view filePath_)
+{
+	std::ifstream file(std::string(filePath_), std::ios::binary);
+	if (file.is_open() == false)
+	{
+		return false;
+	}
+	replayData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	replayPos = 0;
+
+	std::array<char, 4> magic{};
+	uint32_t version = 0;
+	uint32_t numSeeds = 0;
+	if (read(magic.data(), magic.size()) == false ||
+		magic != FileMagic ||
+		read(&version, sizeof(version)) == false ||
+		version != FileVersion ||
+		read(&numSeeds, sizeof(numSeeds)) == false)
+	{
+		replayData.clear();
+		return false;
+	}
+	seeds.resize(numSeeds);
+	if (read(seeds.data(), seeds.size() * sizeof(uint64_t)) == false)
+	{
+		replayData.clear();
+		return false;
+	}
+	for (size_t i = 0; i < seeds.size() && i < (size_t)RandomStream::Size; i++)
+	{
+		RandomGenerator::seed((RandomStream)i, seeds[i]);
+	}
+	mode = Mode::Replay;
+	filePath = filePath_;
+	return true;
+}
+
+void InputRecorder::begin(sf::Vector2i& mousePos)
+{
+	if (mode == Mode::Record)
+	{
+		write(FileMagic.data(), FileMagic.size());
+		write(&FileVersion, sizeof(FileVersion));
+		auto numSeeds = (uint32_t)seeds.size();
+		write(&numSeeds, sizeof(numSeeds));
+		write(seeds.data(), seeds.size() * sizeof(uint64_t));
+		write(&mousePos.x, sizeof(mousePos.x));
+		write(&mousePos.y, sizeof(mousePos.y));
+		mousePosition = mousePos;
+	}
+	else if (mode == Mode::Replay)
+	{
+		read(&mousePosition.x, sizeof(mousePosition.x));
+		read(&mousePosition.y, sizeof(mousePosition.y));
+		mousePos = mousePosition;
+	}
+}
+
+void InputRecorder::addEvent(const sf::Event& evt)
+{
+	if (mode != Mode::Record ||
+		isRecordedEvent(evt.type) == false)
+	{
+		return;
+	}
+	frameEvents.push_back(evt);
+	updateInputState(evt);
+}
+
+void InputRecorder::writeEvents(size_t startIdx, size_t endIdx)
+{
+	auto numEvents = (uint16_t)(endIdx - startIdx);
+	write(&numEvents, sizeof(numEvents));
+	for (size_t i = startIdx; i < endIdx; i++)
+	{
+		writeEvent(frameEvents[i]);
+	}
+}
+
+bool InputRecorder::readEvents()
+{
+	uint16_t numEvents;
+	if (read(&numEvents, sizeof(numEvents)) == false)
+	{
+		return false;
+	}
+	for (size_t i = 0; i < numEvents; i++)
+	{
+		sf::Event evt;
+		if (readEvent(evt) == false)
+		{
+			return false;
+		}
+		frameEvents.push_back(evt);
+	}
+	return true;
+}
+
+void InputRecorder::endFrame(sf::Time elapsedTime)
+{
+	if (mode != Mode::Record)
+	{
+		return;
+	}
+	auto tag = RecordTag::Frame;
+	auto elapsedUs = (int64_t)elapsedTime.asMicroseconds();
+	write(&tag, sizeof(tag));
+	write(&elapsedUs, sizeof(elapsedUs));
+	// the event count is 16 bit, so bigger frames are split in more records
+	size_t startIdx = 0;
+	while (true)
+	{
+		auto endIdx = std::min(frameEvents.size(), startIdx + MaxRecordEvents);
+		writeEvents(startIdx, endIdx);
+		startIdx = endIdx;
+		if (startIdx >= frameEvents.size())
+		{
+			break;
+		}
+		tag = RecordTag::FrameEvents;
+		write(&tag, sizeof(tag));
+	}
+	frameEvents.clear();
+}
+
+bool InputRecorder::nextFrame(sf::Time& elapsedTime)
+{
+	frameEvents.clear();
+	frameEventIdx = 0;
+
+	RecordTag tag;
+	if (mode != Mode::Replay ||
+		read(&tag, sizeof(tag)) == false)
+	{
+		return false;
+	}
+	if (tag == RecordTag::End)
+	{
+		hasRecordedChecksum = read(&recordedChecksum, sizeof(recordedChecksum));
+		replayPos = replayData.size();
+		return false;
+	}
+	int64_t elapsedUs;
+	if (tag != RecordTag::Frame ||
+		read(&elapsedUs, sizeof(elapsedUs)) == false ||
+		readEvents() == false)
+	{
+		return false;
+	}
+	while (replayPos < replayData.size() &&
+		replayData[replayPos] == (uint8_t)RecordTag::FrameEvents)
+	{
+		replayPos++;
+		if (readEvents() == false)
+		{
+			return false;
+		}
+	}
+	elapsedTime = sf::microseconds(elapsedUs);
+	return true;
+}
+
+bool InputRecorder::pollEvent(sf::Event& evt) noexcept
+{
+	if (frameEventIdx >= frameEvents.size())
+	{
+		return false;
+	}
+	evt = frameEvents[frameEventIdx++];
+	updateInputState(evt);
+	return true;
+}
+
+void InputRecorder::addFrameTime(sf::Time elapsedTime, sf::Time frameTime)
+{
+	frameTimings.push_back({ elapsedTime, frameTime });
+}
+
+void InputRecorder::end(uint64_t stateChecksum)
+{
+	if (mode == Mode::Record)
+	{
+		auto tag = RecordTag::End;
+		write(&tag, sizeof(tag));
+		write(&stateChecksum, sizeof(stateChecksum));
+		recordFile.close();
+	}
+	else if (mode == Mode::Replay)
+	{
+		// per frame timings
+		std::ofstream csvFile(filePath + ".csv", std::ios::trunc);
+		csvFile << "frame,elapsedTime,frameTime\n";
+		sf::Time totalTime;
+		for (size_t i = 0; i < frameTimings.size(); i++)
+		{
+			const auto& timing = frameTimings[i];
+			csvFile << i << ',' << timing.elapsedTime.asMicroseconds() <<
+				',' << timing.frameTime.asMicroseconds() << '\n';
+			totalTime += timing.frameTime;
+		}
+
+		std::vector<sf::Time> frameTimes;
+		frameTimes.reserve(frameTimings.size());
+		for (const auto& timing : frameTimings)
+		{
+			frameTimes.push_back(timing.frameTime);
+		}
+		std::sort(frameTimes.begin(), frameTimes.end());
+		auto percentile = [&frameTimes](size_t pct) -> float
+		{
+			if (frameTimes.empty() == true)
+			{
+				return 0.f;
+			}
+			return frameTimes[(frameTimes.size() - 1) * pct / 100].asSeconds() * 1000.f;
+		};
+
+		replayFailed = hasRecordedChecksum == false || recordedChecksum != stateChecksum;
+
+		char buffer[512];
+		std::snprintf(buffer, sizeof(buffer),
+			"frames: %zu\ntotal: %.2f ms\nmedian: %.3f ms\np99: %.3f ms\nmax: %.3f ms\n"
+			"checksum: %016llx\nrecorded checksum: %016llx\nresult: %s\n",
+			frameTimes.size(),
+			totalTime.asSeconds() * 1000.f,
+			percentile(50),
+			percentile(99),
+			percentile(100),
+			(unsigned long long)stateChecksum,
+			(unsigned long long)recordedChecksum,
+			(replayFailed == false ? "match" : "mismatch"));
+		std::cout << buffer;
+	}
+	mode = Mode::None;
+}
+
+bool InputRecorder::isActive(const InputEvent& evt) const
+{
+	// recording answers from the events too, so replays see the same state.
+	if (mode == Mode::None)
+	{
+		return evt.isActive();
+	}
+	switch (evt.type)
+	{
+	case InputType::Mouse:
+		return evt.value >= 0 && evt.value < (int32_t)mouseButtons.size() && mouseButtons[evt.value];
+	case InputType::Keyboard:
+		return evt.value >= 0 && evt.value < (int32_t)keys.size() && keys[evt.value];
+	case InputType::Scancode:
+		return evt.value >= 0 && evt.value < (int32_t)scancodes.size() && scancodes[evt.value];
+	default:
+		return false;
+	}
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <fstream>
+#include "InputEvent.h"
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Window/Event.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// records the input events and frame times of a session, along with the random seeds
+// and a checksum of the final game state, and plays them back as fast as possible.
+// file layout: header (magic, version, seeds, mouse position), then one record per frame
+// (elapsed time, events, followed by more event records if it has over 65535 events),
+// then the final state checksum.
+class InputRecorder
+{
+public:
+	enum class Mode : uint8_t
+	{
+		None,
+		Record,
+		Replay
+	};
+
+private:
+	struct FrameTiming
+	{
+		sf::Time elapsedTime;
+		sf::Time frameTime;
+	};
+
+	Mode mode{ Mode::None };
+	std::string filePath;
+	std::ofstream recordFile;
+	std::vector<uint64_t> seeds;
+
+	// events of the current frame (recorded or to replay)
+	std::vector<sf::Event> frameEvents;
+	size_t frameEventIdx{ 0 };
+
+	std::vector<uint8_t> replayData;
+	size_t replayPos{ 0 };
+	std::vector<FrameTiming> frameTimings;
+	uint64_t recordedChecksum{ 0 };
+	bool hasRecordedChecksum{ false };
+	bool replayFailed{ false };
+
+	// input state built from the recorded events. used instead of polling
+	// while recording and replaying.
+	std::bitset<sf::Keyboard::KeyCount> keys;
+	std::bitset<sf::Keyboard::Scan::ScancodeCount> scancodes;
+	std::bitset<sf::Mouse::ButtonCount> mouseButtons;
+	sf::Vector2i mousePosition;
+
+	void write(const void* data, size_t size);
+	bool read(void* data, size_t size) noexcept;
+
+	void writeEvent(const sf::Event& evt);
+	bool readEvent(sf::Event& evt) noexcept;
+
+	// writes the count and the events [startIdx, endIdx) of the current frame.
+	void writeEvents(size_t startIdx, size_t endIdx);
+	// appends the count and events read to the current frame.
+	bool readEvents();
+
+	void updateInputState(const sf::Event& evt) noexcept;
+
+public:
+	static constexpr uint32_t FileVersion = 1;
+
+	Mode getMode() const noexcept { return mode; }
+	bool isRecording() const noexcept { return mode == Mode::Record; }
+	bool isReplaying() const noexcept { return mode == Mode::Replay; }
+	bool hasReplayFailed() const noexcept { return replayFailed; }
+
+	// saves the current random seeds. the file is written when the game starts playing.
+	bool startRecording(const std::string_view filePath_);
+
+	// loads the whole recording and restores its random seeds.
+	bool startReplay(const std::string_view filePath_);
+
+	// writes the header, or reads the initial mouse position when replaying.
+	void begin(sf::Vector2i& mousePos);
+
+	// record mode: adds an event polled from the window to the current frame.
+	void addEvent(const sf::Event& evt);
+
+	// record mode: writes the current frame.
+	void endFrame(sf::Time elapsedTime);
+
+	// replay mode: reads the next frame. returns false when there are no more frames.
+	bool nextFrame(sf::Time& elapsedTime);
+
+	// replay mode: gets the next event of the current frame.
+	bool pollEvent(sf::Event& evt) noexcept;
+
+	// replay mode: time taken to process a frame.
+	void addFrameTime(sf::Time elapsedTime, sf::Time frameTime);
+
+	// writes the checksum of the final state (record mode) or compares it with
+	// the recorded one and reports the frame timings (replay mode).
+	void end(uint64_t stateChecksum);
+
+	// polls the input, or answers from the recorded events while recording or replaying.
+	bool isActive(const InputEvent& evt) const;
+
+	auto& MousePosition() const noexcept { return mousePosition; }
+};
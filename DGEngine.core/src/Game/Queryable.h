@@ -14,5 +14,18 @@ public:
 
 	virtual bool getProperty(const std::string_view prop, Variable& var) const = 0;
 
+	// same as getProperty, with prop already split in 2 at the first '.'
+	// and the first part hashed (propHash). propArgs is the second part.
+	// override to skip splitting and hashing prop on every call.
+	virtual bool getPropertyByHash(const std::string_view prop, uint16_t propHash,
+		const std::string_view propArgs, Variable& var) const
+	{
+		return getProperty(prop, var);
+	}
+
+	// changes whenever a value returned by getProperty changes.
+	// 0 means it can change at any time (results are never cached).
+	virtual uint32_t PropertyVersion() const noexcept { return 0; }
+
 	virtual QueryObject getQueryable(const std::string_view prop) const { return {}; }
 };
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// id of a drawable or resource that caches the resolved object.
+// resolve with ResourceManager::get. the cached object is only reused while the
+// ResourceManager's generation is unchanged, so popped resources are never returned.
+template <class T>
+class ResourceHandle
+{
+private:
+	std::string id;
+	mutable T* obj{ nullptr };
+	mutable uint32_t generation{ 0 };
+
+	friend class ResourceManager;
+
+public:
+	ResourceHandle() = default;
+	ResourceHandle(const std::string_view id_) : id(id_) {}
+
+	const std::string& Id() const noexcept { return id; }
+};
@@ -1,8 +1,98 @@
 #include "ResourceManager.h"
+#include <algorithm>
 #include <cctype>
 #include "Game.h"
 #include "Game/Drawables/Button.h"
 
+void ResourceManager::addToIndex(UnorderedStringMap<std::vector<size_t>>& index,
+	const std::string_view key, size_t bundleIdx)
+{
+	auto it = index.find(key);
+	if (it == index.end())
+	{
+		index.emplace(key, std::vector<size_t>{ bundleIdx });
+		return;
+	}
+	auto& bundles = it->second;
+	auto it2 = std::lower_bound(bundles.begin(), bundles.end(), bundleIdx);
+	if (it2 == bundles.end() || *it2 != bundleIdx)
+	{
+		bundles.insert(it2, bundleIdx);
+	}
+}
+
+void ResourceManager::removeFromIndex(UnorderedStringMap<std::vector<size_t>>& index,
+	const std::string_view key, size_t bundleIdx)
+{
+	auto it = index.find(key);
+	if (it == index.end())
+	{
+		return;
+	}
+	auto& bundles = it->second;
+	auto it2 = std::lower_bound(bundles.begin(), bundles.end(), bundleIdx);
+	if (it2 != bundles.end() && *it2 == bundleIdx)
+	{
+		bundles.erase(it2);
+	}
+	if (bundles.empty() == true)
+	{
+		index.erase(it);
+	}
+}
+
+void ResourceManager::removeFromIndexes(size_t bundleIdx)
+{
+	const auto& res = resources[bundleIdx];
+	for (const auto& obj : res.resources)
+	{
+		removeFromIndex(resourceIndex, obj.first, bundleIdx);
+	}
+	for (const auto& obj : res.drawableIds)
+	{
+		removeFromIndex(drawableIndex, obj.first, bundleIdx);
+	}
+	generation++;
+}
+
+void ResourceManager::rebuildIndexes()
+{
+	resourceIndex.clear();
+	drawableIndex.clear();
+	for (size_t i = 0; i < resources.size(); i++)
+	{
+		for (const auto& obj : resources[i].resources)
+		{
+			addToIndex(resourceIndex, obj.first, i);
+		}
+		for (const auto& obj : resources[i].drawableIds)
+		{
+			addToIndex(drawableIndex, obj.first, i);
+		}
+	}
+	generation++;
+}
+
+void ResourceManager::stopSounds(const ResourceBundle& res)
+{
+	for (const auto& obj : res.resources)
+	{
+		if (std::holds_alternative<AudioSource>(obj.second) == false)
+		{
+			continue;
+		}
+		const auto& audioSource = std::get<AudioSource>(obj.second);
+		if (std::holds_alternative<std::shared_ptr<sf::SoundBuffer>>(audioSource) == true)
+		{
+			sounds.stop(*std::get<std::shared_ptr<sf::SoundBuffer>>(audioSource));
+		}
+		else if (std::holds_alternative<std::shared_ptr<SoundBufferLoops>>(audioSource) == true)
+		{
+			sounds.stop(std::get<std::shared_ptr<SoundBufferLoops>>(audioSource)->soundBuffer);
+		}
+	}
+}
+
 void ResourceManager::addResource(const std::string& id)
 {
 	resources.push_back(ResourceBundle(id));
@@ -12,6 +102,8 @@ void ResourceManager::popResource()
 {
 	if (resources.size() > 0)
 	{
+		removeFromIndexes(resources.size() - 1);
+		stopSounds(resources.back());
 		resources.pop_back();
 	}
 }
@@ -22,7 +114,15 @@ void ResourceManager::popResource(const std::string& id)
 	{
 		if (it->id == id)
 		{
+			if (it == resources.rbegin())
+			{
+				popResource();
+				return;
+			}
+			// bundles above the removed one move down, so their indexes change
+			stopSounds(*it);
 			resources.erase(--it.base());
+			rebuildIndexes();
 			return;
 		}
 	}
@@ -34,7 +134,13 @@ void ResourceManager::popAllResources(const std::string& id)
 	{
 		if (it->id == id && it.base() != resources.begin())
 		{
-			resources.erase(--it.base(), resources.end());
+			auto firstIdx = (size_t)std::distance(resources.begin(), --it.base());
+			for (auto i = resources.size(); i > firstIdx; i--)
+			{
+				removeFromIndexes(i - 1);
+				stopSounds(resources[i - 1]);
+			}
+			resources.erase(resources.begin() + firstIdx, resources.end());
 			return;
 		}
 	}
@@ -42,12 +148,17 @@ void ResourceManager::popAllResources(const std::string& id)
 
 void ResourceManager::popAllResources(bool popBaseResources)
 {
+	for (size_t i = (popBaseResources ? 0 : 1); i < resources.size(); i++)
+	{
+		stopSounds(resources[i]);
+	}
 	resources.resize(1);
 	if (popBaseResources)
 	{
 		resources.front() = {};
 		currentLevel.reset();
 	}
+	rebuildIndexes();
 }
 
 void ResourceManager::ignoreResources(const std::string& id, IgnoreResource ignore) noexcept
@@ -90,6 +201,7 @@ void ResourceManager::bringResourceToFront(const std::string& id)
 	if (it != resources.end())
 	{
 		std::rotate(it, it + 1, resources.end());
+		rebuildIndexes();
 	}
 }
 
@@ -229,6 +341,8 @@ void ResourceManager::addDrawable(ResourceBundle& res, const std::string_view ke
 		{
 			it2.first->second = obj;
 		}
+		addToIndex(drawableIndex, key, getBundleIndex(res));
+		generation++;
 		if (manageObjDrawing == true)
 		{
 			res.drawables.push_back(obj.get());
@@ -255,38 +369,6 @@ void ResourceManager::addDrawable(const std::string_view key,
 	}
 }
 
-void ResourceManager::addPlayingSound(const sf::Sound& obj, bool unique, sf::Time seek)
-{
-	if (unique == true)
-	{
-		for (const auto& snd : playingSounds)
-		{
-			if (snd.getBuffer() == obj.getBuffer())
-			{
-				return;
-			}
-		}
-	}
-	playingSounds.push_back(obj);
-	playingSounds.back().play();
-	playingSounds.back().setPlayingOffset(seek);
-}
-
-void ResourceManager::clearFinishedSounds()
-{
-	for (auto it = playingSounds.begin(); it != playingSounds.end();)
-	{
-		if ((*it).getStatus() != sf::Sound::Playing)
-		{
-			it = playingSounds.erase(it);
-		}
-		else
-		{
-			++it;
-		}
-	}
-}
-
 std::shared_ptr<Action> ResourceManager::getInputAction(const sf::Event& key) const
 {
 	for (const auto& res : reverse(resources))
@@ -455,14 +537,7 @@ bool ResourceManager::hasTexturePack(const std::string_view key) const
 
 bool ResourceManager::hasDrawable(const std::string_view key) const
 {
-	for (const auto& resource : resources)
-	{
-		if (resource.drawableIds.find(key) != resource.drawableIds.cend())
-		{
-			return true;
-		}
-	}
-	return false;
+	return drawableIndex.find(key) != drawableIndex.cend();
 }
 
 void ResourceManager::bringDrawableToFront(const std::string& id)
@@ -514,6 +589,8 @@ void ResourceManager::deleteDrawable(const std::string& id)
 		{
 			auto objPtr = it1->second.get();
 			res.drawableIds.erase(it1);
+			removeFromIndex(drawableIndex, id, getBundleIndex(res));
+			generation++;
 			auto& drawables = res.drawables;
 			for (auto it2 = drawables.begin(); it2 != drawables.end(); ++it2)
 			{
@@ -609,6 +686,12 @@ void ResourceManager::deleteSong(const std::string_view key)
 				if (std::holds_alternative<AudioSource>(range.first->second) == true)
 				{
 					res.resources.erase(range.first);
+					// other resources can share the key
+					if (res.resources.find(key) == res.resources.end())
+					{
+						removeFromIndex(resourceIndex, key, getBundleIndex(res));
+					}
+					generation++;
 					return;
 				}
 			}
@@ -860,7 +943,7 @@ bool ResourceManager::hasActiveInputEvents(const std::initializer_list<uint16_t>
 	return count >= nameHashes.size();
 }
 
-void ResourceManager::updateActiveInputEvents()
+void ResourceManager::updateActiveInputEvents(const InputRecorder& inputRecorder)
 {
 	activeInputEvents.clear();
 
@@ -873,7 +956,7 @@ void ResourceManager::updateActiveInputEvents()
 		}
 		for (const auto& evt : res.inputEvents)
 		{
-			if (evt.first.isActive() == true &&
+			if (inputRecorder.isActive(evt.first) == true &&
 				std::find(used.cbegin(), used.cend(), evt.first) == used.cend())
 			{
 				activeInputEvents.push_back(evt.second);
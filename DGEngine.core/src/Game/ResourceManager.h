@@ -1,12 +1,14 @@
 #pragma once
 
 #include <initializer_list>
-#include <list>
 #include "ResourceBundle.h"
+#include "ResourceHandle.h"
 #include "ShaderManager.h"
+#include "SoundManager.h"
 #include "Utils/ReverseIterable.h"
 
 class Image;
+class InputRecorder;
 
 class ResourceManager
 {
@@ -15,9 +17,28 @@ private:
 	ShaderManager shaders;
 	std::vector<std::shared_ptr<Image>> cursors;
 	std::vector<uint16_t> activeInputEvents;
-	std::list<sf::Sound> playingSounds;
+	SoundManager sounds;
 	std::weak_ptr<UIObject> currentLevel;
 
+	// indexes (bottom to top) of the bundles that have a resource / drawable with a given id.
+	UnorderedStringMap<std::vector<size_t>> resourceIndex;
+	UnorderedStringMap<std::vector<size_t>> drawableIndex;
+	// incremented whenever a lookup by id can return a different object.
+	uint32_t generation{ 1 };
+
+	size_t getBundleIndex(const ResourceBundle& res) const noexcept { return (size_t)(&res - resources.data()); }
+
+	static void addToIndex(UnorderedStringMap<std::vector<size_t>>& index,
+		const std::string_view key, size_t bundleIdx);
+	static void removeFromIndex(UnorderedStringMap<std::vector<size_t>>& index,
+		const std::string_view key, size_t bundleIdx);
+
+	void removeFromIndexes(size_t bundleIdx);
+	void rebuildIndexes();
+
+	// stops the sounds playing the bundle's buffers. called before a bundle is removed.
+	void stopSounds(const ResourceBundle& res);
+
 	bool addSong(ResourceBundle& res,
 		const std::string_view key, const std::shared_ptr<sf::Music2>& obj);
 
@@ -34,11 +55,26 @@ private:
 		if (res.hasResource<T>(key) == false)
 		{
 			res.resources.insert(std::make_pair(key, obj));
+			addToIndex(resourceIndex, key, getBundleIndex(res));
+			generation++;
 			return true;
 		}
 		return false;
 	}
 
+	template <class T>
+	T* findResource(const std::string_view key) const
+	{
+		if constexpr (std::is_base_of_v<UIObject, T> == true)
+		{
+			return getDrawable<T>(key);
+		}
+		else
+		{
+			return getResource<std::shared_ptr<T>>(key).get();
+		}
+	}
+
 public:
 	auto begin() noexcept { return resources.begin(); }
 	auto end() noexcept { return resources.end(); }
@@ -114,11 +150,17 @@ public:
 	void addDrawable(const std::string_view key, const std::shared_ptr<UIObject>& obj,
 		bool manageObjDrawing, const std::string_view resourceId = {});
 
-	void addPlayingSound(const sf::Sound& obj, bool unique = false,
-		sf::Time seek = sf::Time::Zero);
+	SoundManager& Sounds() noexcept { return sounds; }
+	const SoundManager& Sounds() const noexcept { return sounds; }
+
+	void addPlayingSound(const sf::SoundBuffer& obj, float volume, bool unique = false,
+		sf::Time seek = sf::Time::Zero, int priority = 0)
+	{
+		sounds.play(obj, volume, unique, seek, priority);
+	}
 
-	void clearFinishedSounds();
-	void clearPlayingSounds() noexcept { playingSounds.clear(); }
+	void clearFinishedSounds() { sounds.update(); }
+	void clearPlayingSounds() noexcept { sounds.clear(); }
 
 	template <class T>
 	bool addResource(const std::string_view key, const T& obj, const std::string_view resourceId)
@@ -157,9 +199,14 @@ public:
 	template <class T>
 	T getResource(const std::string_view key) const
 	{
-		for (const auto& res : reverse(resources))
+		auto it = resourceIndex.find(key);
+		if (it == resourceIndex.cend())
+		{
+			return {};
+		}
+		for (auto idx : reverse(it->second))
 		{
-			auto range = res.resources.equal_range(key);
+			auto range = resources[idx].resources.equal_range(key);
 			for (; range.first != range.second; ++range.first)
 			{
 				if (std::holds_alternative<T>(range.first->second) == true)
@@ -171,6 +218,19 @@ public:
 		return {};
 	}
 
+	// resolves the handle's id, reusing the last result until a resource or drawable
+	// is added or removed. T is either a drawable or a shared resource (Palette, TexturePack, ...).
+	template <class T>
+	T* get(const ResourceHandle<T>& handle) const
+	{
+		if (handle.generation != generation)
+		{
+			handle.obj = findResource<T>(handle.id);
+			handle.generation = generation;
+		}
+		return handle.obj;
+	}
+
 	std::shared_ptr<Action> getInputAction(const sf::Event& key) const;
 	std::shared_ptr<Action> getAction(const std::string_view key) const;
 	std::shared_ptr<FileBytes> getFileBytes(const std::string_view key) const;
@@ -205,12 +265,14 @@ public:
 	template <class T>
 	T* getDrawable(const std::string_view key) const
 	{
-		for (const auto& res : reverse(resources))
+		auto it = drawableIndex.find(key);
+		if (it != drawableIndex.cend())
 		{
-			auto it = res.drawableIds.find(key);
-			if (it != res.drawableIds.cend())
+			const auto& drawableIds = resources[it->second.back()].drawableIds;
+			auto it2 = drawableIds.find(key);
+			if (it2 != drawableIds.cend())
 			{
-				return dynamic_cast<T*>(it->second.get());
+				return dynamic_cast<T*>(it2->second.get());
 			}
 		}
 		return nullptr;
@@ -219,12 +281,14 @@ public:
 	template <class T>
 	std::shared_ptr<T> getDrawableSharedPtr(const std::string_view key) const
 	{
-		for (const auto& res : reverse(resources))
+		auto it = drawableIndex.find(key);
+		if (it != drawableIndex.cend())
 		{
-			auto it = res.drawableIds.find(key);
-			if (it != res.drawableIds.cend())
+			const auto& drawableIds = resources[it->second.back()].drawableIds;
+			auto it2 = drawableIds.find(key);
+			if (it2 != drawableIds.cend())
 			{
-				return std::dynamic_pointer_cast<T>(it->second);
+				return std::dynamic_pointer_cast<T>(it2->second);
 			}
 		}
 		return nullptr;
@@ -254,5 +318,5 @@ public:
 
 	bool hasActiveInputEvents() const noexcept { return activeInputEvents.empty() == false; }
 	bool hasActiveInputEvents(const std::initializer_list<uint16_t> nameHashes) const;
-	void updateActiveInputEvents();
+	void updateActiveInputEvents(const InputRecorder& inputRecorder);
 };
@@ -0,0 +1,310 @@
+#include "SoundManager.h"
+
+bool SoundManager::canPlay(const sf::SoundBuffer& buffer, bool unique) const
+{
+	if (maxVoices == 0)
+	{
+		return false;
+	}
+	auto it = bufferInstances.find(&buffer);
+	return it == bufferInstances.end() ||
+		(unique == false && it->second < maxInstances);
+}
+
+bool SoundManager::isInRange(const sf::Vector2f& position) const noexcept
+{
+	if (maxDistance <= 0.f)
+	{
+		return true;
+	}
+	auto diff = position - listenerPosition;
+	return diff.x * diff.x + diff.y * diff.y <= maxDistance * maxDistance;
+}
+
+SoundManager::Voice* SoundManager::getFreeVoice(int priority, bool stealSamePriority)
+{
+	if (freeVoices.empty() == false)
+	{
+		auto idx = freeVoices.back();
+		freeVoices.pop_back();
+		return &voices[idx];
+	}
+	if (voices.size() < maxVoices)
+	{
+		return &voices.emplace_back();
+	}
+
+	// steal a finished voice or the lowest priority one, oldest first
+	size_t stealIdx = voices.size();
+	for (size_t i = 0; i < voices.size(); i++)
+	{
+		const auto& voice = voices[i];
+		if (voice.sound.getStatus() != sf::Sound::Playing)
+		{
+			stealIdx = i;
+			break;
+		}
+		if (voice.priority > priority ||
+			(voice.priority == priority && stealSamePriority == false))
+		{
+			continue;
+		}
+		if (stealIdx == voices.size() ||
+			voice.priority < voices[stealIdx].priority ||
+			(voice.priority == voices[stealIdx].priority &&
+				voice.id < voices[stealIdx].id))
+		{
+			stealIdx = i;
+		}
+	}
+	if (stealIdx == voices.size())
+	{
+		return nullptr;
+	}
+	releaseVoice(stealIdx);
+	freeVoices.pop_back();
+	return &voices[stealIdx];
+}
+
+void SoundManager::startVoice(Voice& voice, const sf::SoundBuffer& buffer, float volume,
+	sf::Time seek, int priority, const sf::Vector2f* position, uint64_t id)
+{
+	voice.buffer = &buffer;
+	voice.id = id;
+	voice.priority = priority;
+	voice.positional = (position != nullptr);
+	voice.position = (position != nullptr ? *position : sf::Vector2f());
+	voice.active = true;
+
+	voice.sound.setBuffer(buffer);
+	voice.sound.setVolume(volume);
+	voice.sound.play();
+	voice.sound.setPlayingOffset(seek);
+}
+
+void SoundManager::stopVoice(size_t idx)
+{
+	auto& voice = voices[idx];
+	voice.sound.stop();
+	voice.active = false;
+	voice.buffer = nullptr;
+	freeVoices.push_back(idx);
+}
+
+void SoundManager::releaseVoice(size_t idx)
+{
+	removeInstance(voices[idx].buffer);
+	stopVoice(idx);
+}
+
+void SoundManager::releaseVirtualVoice(size_t idx)
+{
+	removeInstance(virtualVoices[idx].buffer);
+	virtualVoices[idx] = virtualVoices.back();
+	virtualVoices.pop_back();
+}
+
+void SoundManager::removeInstance(const sf::SoundBuffer* buffer)
+{
+	auto it = bufferInstances.find(buffer);
+	if (it != bufferInstances.end())
+	{
+		if (it->second <= 1)
+		{
+			bufferInstances.erase(it);
+		}
+		else
+		{
+			it->second--;
+		}
+	}
+}
+
+uint64_t SoundManager::play(const sf::SoundBuffer& buffer, float volume, bool unique,
+	sf::Time seek, int priority)
+{
+	if (canPlay(buffer, unique) == false)
+	{
+		return 0;
+	}
+	auto voice = getFreeVoice(priority);
+	if (voice == nullptr)
+	{
+		return 0;
+	}
+	auto id = ++lastId;
+	startVoice(*voice, buffer, volume, seek, priority, nullptr, id);
+	bufferInstances[&buffer]++;
+	return id;
+}
+
+uint64_t SoundManager::play(const sf::SoundBuffer& buffer, float volume, const sf::Vector2f& position,
+	bool unique, sf::Time seek, int priority)
+{
+	if (canPlay(buffer, unique) == false)
+	{
+		return 0;
+	}
+	if (isInRange(position) == false)
+	{
+		if (virtualVoices.size() >= maxVirtualVoices ||
+			seek >= buffer.getDuration())
+		{
+			return 0;
+		}
+		auto id = ++lastId;
+		virtualVoices.push_back({ &buffer, position, clock.getElapsedTime() - seek,
+			buffer.getDuration(), volume, id, priority });
+		bufferInstances[&buffer]++;
+		return id;
+	}
+	auto voice = getFreeVoice(priority);
+	if (voice == nullptr)
+	{
+		return 0;
+	}
+	auto id = ++lastId;
+	startVoice(*voice, buffer, volume, seek, priority, &position, id);
+	bufferInstances[&buffer]++;
+	return id;
+}
+
+void SoundManager::stop(uint64_t id)
+{
+	if (id == 0)
+	{
+		return;
+	}
+	for (size_t i = 0; i < voices.size(); i++)
+	{
+		if (voices[i].active == true && voices[i].id == id)
+		{
+			releaseVoice(i);
+			return;
+		}
+	}
+	for (size_t i = 0; i < virtualVoices.size(); i++)
+	{
+		if (virtualVoices[i].id == id)
+		{
+			releaseVirtualVoice(i);
+			return;
+		}
+	}
+}
+
+void SoundManager::stop(const sf::SoundBuffer& buffer)
+{
+	if (bufferInstances.erase(&buffer) == 0)
+	{
+		return;
+	}
+	for (size_t i = 0; i < voices.size(); i++)
+	{
+		if (voices[i].active == true && voices[i].buffer == &buffer)
+		{
+			stopVoice(i);
+		}
+	}
+	for (size_t i = 0; i < virtualVoices.size();)
+	{
+		if (virtualVoices[i].buffer == &buffer)
+		{
+			virtualVoices[i] = virtualVoices.back();
+			virtualVoices.pop_back();
+			continue;
+		}
+		i++;
+	}
+}
+
+bool SoundManager::isPlaying(const sf::SoundBuffer& buffer) const
+{
+	return bufferInstances.find(&buffer) != bufferInstances.end();
+}
+
+void SoundManager::MaxVoices(size_t maxVoices_)
+{
+	if (maxVoices == maxVoices_)
+	{
+		return;
+	}
+	clear();
+	voices.clear();
+	voices.shrink_to_fit();
+	freeVoices.clear();
+	maxVoices = maxVoices_;
+	voices.reserve(maxVoices);
+	freeVoices.reserve(maxVoices);
+}
+
+void SoundManager::update()
+{
+	if (freeVoices.size() == voices.size() &&
+		virtualVoices.empty() == true)
+	{
+		return;
+	}
+	auto now = clock.getElapsedTime();
+	for (size_t i = 0; i < voices.size(); i++)
+	{
+		auto& voice = voices[i];
+		if (voice.active == false)
+		{
+			continue;
+		}
+		if (voice.sound.getStatus() != sf::Sound::Playing)
+		{
+			releaseVoice(i);
+		}
+		else if (voice.positional == true &&
+			isInRange(voice.position) == false &&
+			virtualVoices.size() < maxVirtualVoices)
+		{
+			// keeps its buffer instance
+			virtualVoices.push_back({ voice.buffer, voice.position,
+				now - voice.sound.getPlayingOffset(), voice.buffer->getDuration(),
+				voice.sound.getVolume(), voice.id, voice.priority });
+			stopVoice(i);
+		}
+	}
+	for (size_t i = 0; i < virtualVoices.size();)
+	{
+		const auto& virtualVoice = virtualVoices[i];
+		auto offset = now - virtualVoice.startTime;
+		if (offset >= virtualVoice.duration)
+		{
+			releaseVirtualVoice(i);
+			continue;
+		}
+		if (isInRange(virtualVoice.position) == true)
+		{
+			// doesn't take the voice of a sound with the same priority
+			auto voice = getFreeVoice(virtualVoice.priority, false);
+			if (voice != nullptr)
+			{
+				startVoice(*voice, *virtualVoice.buffer, virtualVoice.volume, offset,
+					virtualVoice.priority, &virtualVoice.position, virtualVoice.id);
+				virtualVoices[i] = virtualVoices.back();
+				virtualVoices.pop_back();
+				continue;
+			}
+		}
+		i++;
+	}
+}
+
+void SoundManager::clear() noexcept
+{
+	freeVoices.clear();
+	for (size_t i = 0; i < voices.size(); i++)
+	{
+		auto& voice = voices[i];
+		voice.sound.stop();
+		voice.buffer = nullptr;
+		voice.active = false;
+		freeVoices.push_back(i);
+	}
+	virtualVoices.clear();
+	bufferInstances.clear();
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <unordered_map>
+#include <vector>
+
+// fixed pool of voices used to play sounds.
+// when all voices are in use, the lowest priority voice (oldest first) is stolen,
+// or the new sound is dropped if it has a lower priority than every playing voice.
+// positional sounds out of range of the listener become virtual: they keep their
+// position and playing offset without a voice and resume when back in range.
+class SoundManager
+{
+private:
+	struct Voice
+	{
+		sf::Sound sound;
+		const sf::SoundBuffer* buffer{ nullptr };
+		sf::Vector2f position;
+		uint64_t id{ 0 };
+		int priority{ 0 };
+		bool positional{ false };
+		bool active{ false };
+	};
+
+	struct VirtualVoice
+	{
+		const sf::SoundBuffer* buffer{ nullptr };
+		sf::Vector2f position;
+		// time of the clock when the sound started (offset is now - startTime)
+		sf::Time startTime;
+		// kept so update doesn't read the buffer
+		sf::Time duration;
+		float volume{ 0.f };
+		uint64_t id{ 0 };
+		int priority{ 0 };
+	};
+
+	// reserved up front and never reallocated, so voices keep their audio source
+	std::vector<Voice> voices;
+	std::vector<size_t> freeVoices;
+	std::vector<VirtualVoice> virtualVoices;
+	// number of voices (virtual included) playing each buffer
+	std::unordered_map<const sf::SoundBuffer*, uint16_t> bufferInstances;
+	sf::Clock clock;
+	sf::Vector2f listenerPosition;
+	float maxDistance{ 0.f };
+	uint64_t lastId{ 0 };
+	size_t maxVoices{ DefaultMaxVoices };
+	size_t maxVirtualVoices{ DefaultMaxVirtualVoices };
+	uint16_t maxInstances{ DefaultMaxInstances };
+
+	bool canPlay(const sf::SoundBuffer& buffer, bool unique) const;
+	bool isInRange(const sf::Vector2f& position) const noexcept;
+
+	// stealSamePriority - if false, only lower priority voices are stolen.
+	Voice* getFreeVoice(int priority, bool stealSamePriority = true);
+
+	void startVoice(Voice& voice, const sf::SoundBuffer& buffer, float volume,
+		sf::Time seek, int priority, const sf::Vector2f* position, uint64_t id);
+
+	// stops the voice and puts it in the free list.
+	void stopVoice(size_t idx);
+	void releaseVoice(size_t idx);
+	void releaseVirtualVoice(size_t idx);
+	void removeInstance(const sf::SoundBuffer* buffer);
+
+public:
+	static constexpr size_t DefaultMaxVoices = 32;
+	static constexpr size_t DefaultMaxVirtualVoices = 64;
+	static constexpr uint16_t DefaultMaxInstances = 4;
+
+	SoundManager()
+	{
+		voices.reserve(maxVoices);
+		freeVoices.reserve(maxVoices);
+		virtualVoices.reserve(maxVirtualVoices);
+	}
+
+	// returns the id of the sound or 0 if the sound was dropped.
+	uint64_t play(const sf::SoundBuffer& buffer, float volume, bool unique = false,
+		sf::Time seek = sf::Time::Zero, int priority = 0);
+
+	// positional sounds further than maxDistance from the listener start as virtual.
+	uint64_t play(const sf::SoundBuffer& buffer, float volume, const sf::Vector2f& position,
+		bool unique = false, sf::Time seek = sf::Time::Zero, int priority = 0);
+
+	// stops the sound with the given id, if it's still playing.
+	void stop(uint64_t id);
+
+	// stops every sound (virtual included) that plays the buffer.
+	// must be called before the buffer is deleted.
+	void stop(const sf::SoundBuffer& buffer);
+
+	bool isPlaying(const sf::SoundBuffer& buffer) const;
+
+	// maxDistance_ of 0 plays every positional sound.
+	void setListener(const sf::Vector2f& position, float maxDistance_) noexcept
+	{
+		listenerPosition = position;
+		maxDistance = maxDistance_;
+	}
+
+	auto MaxVoices() const noexcept { return maxVoices; }
+	void MaxVoices(size_t maxVoices_);
+
+	auto MaxInstances() const noexcept { return maxInstances; }
+	void MaxInstances(uint16_t maxInstances_) noexcept { maxInstances = maxInstances_; }
+
+	size_t getPlayingCount() const noexcept { return voices.size() - freeVoices.size(); }
+	size_t getVirtualCount() const noexcept { return virtualVoices.size(); }
+
+	// releases the voices that finished playing, makes the positional voices
+	// out of range virtual and resumes the virtual voices back in range.
+	void update();
+
+	void clear() noexcept;
+};
@@ -0,0 +1,84 @@
+#include "UIHitIndex.h"
+#include <cmath>
+
+void UIHitIndex::rebuild()
+{
+	for (auto& cell : cells)
+	{
+		cell.second.clear();
+	}
+	for (uint32_t i = 0; i < (uint32_t)entries.size(); i++)
+	{
+		const auto& rect = entries[i].rect;
+		if (rect.width <= 0.f || rect.height <= 0.f)
+		{
+			continue;
+		}
+		auto startX = (int32_t)std::floor(rect.left / CellSize);
+		auto startY = (int32_t)std::floor(rect.top / CellSize);
+		auto endX = (int32_t)std::floor((rect.left + rect.width) / CellSize);
+		auto endY = (int32_t)std::floor((rect.top + rect.height) / CellSize);
+		for (auto y = startY; y <= endY; y++)
+		{
+			for (auto x = startX; x <= endX; x++)
+			{
+				cells[getCellKey(x, y)].push_back(i);
+			}
+		}
+	}
+}
+
+void UIHitIndex::update(const sf::Vector2f& pointer)
+{
+	if (changed == true)
+	{
+		entries.swap(nextEntries);
+		rebuild();
+	}
+	else if (numVisited != entries.size())
+	{
+		// the last buttons weren't visited (hidden or removed)
+		entries.resize(numVisited);
+		rebuild();
+	}
+	nextEntries.clear();
+	numVisited = 0;
+	changed = false;
+
+	const void* hit = nullptr;
+	auto it = cells.find(getCellKey(
+		(int32_t)std::floor(pointer.x / CellSize),
+		(int32_t)std::floor(pointer.y / CellSize)));
+	if (it != cells.end())
+	{
+		// cell entries are in update order, so the first hit is the top-most.
+		for (auto idx : it->second)
+		{
+			if (entries[idx].rect.contains(pointer) == true)
+			{
+				hit = entries[idx].obj;
+				break;
+			}
+		}
+	}
+	topHitChanged = (hit != topHit);
+	topHit = hit;
+}
+
+void UIHitIndex::visit(const void* obj, const sf::FloatRect& rect)
+{
+	if (changed == false)
+	{
+		if (numVisited < entries.size() &&
+			entries[numVisited].obj == obj &&
+			entries[numVisited].rect == rect)
+		{
+			numVisited++;
+			return;
+		}
+		changed = true;
+		nextEntries.assign(entries.begin(), entries.begin() + numVisited);
+	}
+	nextEntries.push_back({ obj, rect });
+	numVisited++;
+}
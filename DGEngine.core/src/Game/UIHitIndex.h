@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <SFML/Graphics/Rect.hpp>
+#include <unordered_map>
+#include <vector>
+
+// grid of the bounds of the visible buttons, in update order (top-most first).
+// buttons visit the index every update, which only compares them with the entry
+// at the same position. the grid is only rebuilt when a button moved, resized,
+// was shown, hidden or reordered. the pointer is resolved once per frame to the
+// top-most button under it, against the bounds of the previous update.
+class UIHitIndex
+{
+public:
+	static constexpr float CellSize = 64.f;
+
+private:
+	struct Entry
+	{
+		const void* obj{ nullptr };
+		sf::FloatRect rect;
+	};
+
+	std::vector<Entry> entries;
+	// the entries of this update, only filled after the first difference.
+	std::vector<Entry> nextEntries;
+	std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+	const void* topHit{ nullptr };
+	uint32_t numVisited{ 0 };
+	bool changed{ false };
+	bool topHitChanged{ false };
+
+	static uint64_t getCellKey(int32_t x, int32_t y) noexcept
+	{
+		return ((uint64_t)(uint32_t)x << 32) | (uint64_t)(uint32_t)y;
+	}
+
+	void rebuild();
+
+public:
+	// called once per frame, before updating. applies the changes of the last update.
+	void update(const sf::Vector2f& pointer);
+
+	// called by every visible button while updating, in update order.
+	void visit(const void* obj, const sf::FloatRect& rect);
+
+	// top-most object under the pointer.
+	const void* getTopHit() const noexcept { return topHit; }
+
+	// true if the top-most object changed in this frame (pointer or layout).
+	bool TopHitChanged() const noexcept { return topHitChanged; }
+
+	auto size() const noexcept { return entries.size(); }
+};
@@ -29,6 +29,10 @@ public:
 	virtual void draw(const Game& game, sf::RenderTarget& target) const = 0;
 	virtual void update(Game& game) {}
 
+	// combines into hash everything that changes how the object is drawn.
+	// returns false if unsupported (the object can't be drawn from a DrawCache).
+	virtual bool getDrawHash(size_t& hash) const { return false; }
+
 	// Visible
 	virtual bool Visible() const = 0;
 	virtual void Visible(bool visible) = 0;
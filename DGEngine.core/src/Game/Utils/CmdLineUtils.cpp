@@ -1,6 +1,9 @@
 #include "CmdLineUtils.h"
 #include "GameUtils.h"
 #include "FileUtils.h"
+#include "Game/Game.h"
+#include <iostream>
+#include "Utils/Random.h"
 #include "Utils/StringHash.h"
 #include "Utils/Utils.h"
 
@@ -46,4 +49,61 @@ namespace CmdLineUtils
 		}
 		return true;
 	}
+
+	void processSeed(int& argc, const char* argv[])
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			auto arg = Utils::splitStringIn2(std::string_view(argv[i]), ':');
+			if (arg.first != "--seed")
+			{
+				continue;
+			}
+			Random::seed(Utils::strtoull(arg.second));
+			for (int j = i + 1; j < argc; j++)
+			{
+				argv[j - 1] = argv[j];
+			}
+			argc--;
+			return;
+		}
+	}
+
+	bool processInputRecording(int& argc, const char* argv[], Game& game)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			auto arg = Utils::splitStringIn2(std::string_view(argv[i]), ':');
+			switch (str2int16(arg.first))
+			{
+			case str2int16("--record"):
+			{
+				if (game.Recorder().startRecording(arg.second) == false)
+				{
+					std::cerr << "could not create the recording: " << arg.second << '\n';
+					return false;
+				}
+				break;
+			}
+			case str2int16("--replay"):
+			{
+				if (game.Recorder().startReplay(arg.second) == false)
+				{
+					std::cerr << "could not load the recording: " << arg.second << '\n';
+					return false;
+				}
+				break;
+			}
+			default:
+				continue;
+			}
+			for (int j = i + 1; j < argc; j++)
+			{
+				argv[j - 1] = argv[j];
+			}
+			argc--;
+			return true;
+		}
+		return true;
+	}
 }
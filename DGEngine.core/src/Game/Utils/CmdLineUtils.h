@@ -1,7 +1,19 @@
 #pragma once
 
+class Game;
+
 namespace CmdLineUtils
 {
 	// returns true if any export command was found (reagrdless of success)
 	bool processCmdLine(int argc, const char* argv[]);
+
+	// seeds all random streams if a "--seed:<number>" argument is found
+	// and removes it from the arguments.
+	void processSeed(int& argc, const char* argv[]);
+
+	// starts recording the input to a file if a "--record:<file>" argument is found
+	// or replays it if a "--replay:<file>" argument is found (restoring the recorded seeds)
+	// and removes it from the arguments.
+	// returns false (and writes the error to stderr) if the file can't be created or loaded.
+	bool processInputRecording(int& argc, const char* argv[], Game& game);
 }
@@ -800,6 +800,46 @@ namespace GameUtils
 		}
 	}
 
+	RandomStream getRandomStream(const std::string_view str, RandomStream val)
+	{
+		switch (str2int16(Utils::toLower(str)))
+		{
+		case str2int16("default"):
+			return RandomStream::Default;
+		case str2int16("level"):
+			return RandomStream::Level;
+		case str2int16("loot"):
+			return RandomStream::Loot;
+		case str2int16("combat"):
+			return RandomStream::Combat;
+		case str2int16("ai"):
+			return RandomStream::AI;
+		case str2int16("cosmetic"):
+			return RandomStream::Cosmetic;
+		default:
+			return val;
+		}
+	}
+
+	std::string_view getRandomStreamName(RandomStream stream) noexcept
+	{
+		switch (stream)
+		{
+		case RandomStream::Level:
+			return "level";
+		case RandomStream::Loot:
+			return "loot";
+		case RandomStream::Combat:
+			return "combat";
+		case RandomStream::AI:
+			return "ai";
+		case RandomStream::Cosmetic:
+			return "cosmetic";
+		default:
+			return "default";
+		}
+	}
+
 	sf::Time getTime(int fps)
 	{
 		fps = std::clamp(fps, 1, 1000);
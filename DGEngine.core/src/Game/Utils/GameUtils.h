@@ -14,6 +14,7 @@
 #include <SFML/Window/Keyboard.hpp>
 #include <string>
 #include <string_view>
+#include "Utils/Random.h"
 #include <vector>
 
 class Game;
@@ -65,6 +66,10 @@ namespace GameUtils
 	sf::PrimitiveType getPrimitiveType(const std::string_view str,
 		sf::PrimitiveType val = sf::PrimitiveType::TriangleFan);
 
+	RandomStream getRandomStream(const std::string_view str, RandomStream val);
+
+	std::string_view getRandomStreamName(RandomStream stream) noexcept;
+
 	sf::Time getTime(int fps);
 
 	Variable getTime(sf::Time time, std::string_view format, bool roundUp = false);
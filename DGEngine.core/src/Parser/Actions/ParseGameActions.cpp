@@ -41,6 +41,12 @@ namespace Parser::Actions
 			getStringViewKey(elem, "mainFile", "main.json"));
 	}
 
+	std::shared_ptr<Action> parseGameSaveProfile(const Value& elem)
+	{
+		return std::make_shared<ActGameSaveProfile>(
+			getStringViewKey(elem, "file", "profile.json"));
+	}
+
 	std::shared_ptr<Action> parseGameSetGamma(const Value& elem)
 	{
 		return std::make_shared<ActGameSetGamma>(getVariableKey(elem, "gamma"));
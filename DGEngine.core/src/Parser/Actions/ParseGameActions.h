@@ -18,6 +18,8 @@ namespace Parser::Actions
 
 	std::shared_ptr<Action> parseGameLoad(const rapidjson::Value& elem);
 
+	std::shared_ptr<Action> parseGameSaveProfile(const rapidjson::Value& elem);
+
 	std::shared_ptr<Action> parseGameSetGamma(const rapidjson::Value& elem);
 
 	std::shared_ptr<Action> parseGameSetMusicVolume(const rapidjson::Value& elem);
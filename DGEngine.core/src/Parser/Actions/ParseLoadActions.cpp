@@ -1,6 +1,7 @@
 #include "ParseLoadActions.h"
 #include "Game/Actions/ActLoad.h"
 #include "Game/Utils/FileUtils.h"
+#include "Game/Utils/GameUtils.h"
 #include "Json/JsonUtils.h"
 #include "Parser/Utils/ParseUtils.h"
 
@@ -48,6 +49,7 @@ namespace Parser::Actions
 	{
 		return std::make_shared<ActLoadRandom>(
 			getStringVectorKey(elem, "file"),
-			getStringViewKey(elem, "endsWith", ".json"));
+			getStringViewKey(elem, "endsWith", ".json"),
+			GameUtils::getRandomStream(getStringViewKey(elem, "stream"), RandomStream::Cosmetic));
 	}
 }
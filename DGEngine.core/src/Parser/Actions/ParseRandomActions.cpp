@@ -1,5 +1,6 @@
 #include "ParseRandomActions.h"
 #include "Game/Actions/ActRandom.h"
+#include "Game/Utils/GameUtils.h"
 #include "Parser/ParseAction.h"
 #include "Parser/Utils/ParseUtils.h"
 
@@ -13,12 +14,14 @@ namespace Parser::Actions
 		return std::make_shared<ActRandom>(
 			getFloatKey(elem, "percentage", 0.5),
 			getActionKey(game, elem, "action1"),
-			getActionKey(game, elem, "action2"));
+			getActionKey(game, elem, "action2"),
+			GameUtils::getRandomStream(getStringViewKey(elem, "stream"), RandomStream::Default));
 	}
 
 	std::shared_ptr<Action> parseRandomList(Game& game, const Value& elem)
 	{
-		auto actionList = std::make_shared<ActRandomList>();
+		auto actionList = std::make_shared<ActRandomList>(
+			GameUtils::getRandomStream(getStringViewKey(elem, "stream"), RandomStream::Default));
 		bool hasActions = false;
 		if (elem.HasMember("actions"sv) == true &&
 			elem["actions"sv].IsArray() == true)
@@ -39,4 +42,19 @@ namespace Parser::Actions
 		}
 		return actionList;
 	}
+
+	std::shared_ptr<Action> parseRandomSeed(const Value& elem)
+	{
+		std::optional<RandomStream> stream;
+		std::optional<uint64_t> seed;
+		if (elem.HasMember("stream"sv) == true)
+		{
+			stream = GameUtils::getRandomStream(getStringViewVal(elem["stream"sv]), RandomStream::Default);
+		}
+		if (elem.HasMember("seed"sv) == true)
+		{
+			seed = getUInt64Val(elem["seed"sv]);
+		}
+		return std::make_shared<ActRandomSeed>(stream, seed);
+	}
 }
@@ -9,4 +9,6 @@ namespace Parser::Actions
 	std::shared_ptr<Action> parseRandom(Game& game, const rapidjson::Value& elem);
 
 	std::shared_ptr<Action> parseRandomList(Game& game, const rapidjson::Value& elem);
+
+	std::shared_ptr<Action> parseRandomSeed(const rapidjson::Value& elem);
 }
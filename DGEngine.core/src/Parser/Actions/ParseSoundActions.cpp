@@ -12,7 +12,8 @@ namespace Parser::Actions
 			getStringViewKey(elem, "file"),
 			getVariableKey(elem, "volume"),
 			getTimeKey(elem, "seek"),
-			getBoolKey(elem, "unique"));
+			getBoolKey(elem, "unique"),
+			getIntKey(elem, "priority"));
 	}
 
 	std::shared_ptr<Action> parseSoundPlay(const Value& elem)
@@ -21,6 +22,7 @@ namespace Parser::Actions
 			getStringViewKey(elem, "id"),
 			getVariableKey(elem, "volume"),
 			getTimeKey(elem, "seek"),
-			getBoolKey(elem, "unique"));
+			getBoolKey(elem, "unique"),
+			getIntKey(elem, "priority"));
 	}
 }
@@ -63,6 +63,7 @@ namespace Parser
 		menu->ScrollPosition(GameUtils::getAlignmentPosition(pos, size, horizAlign, vertAlign));
 		menu->setVerticalPad(getIntKey(elem, "verticalPad"));
 		menu->setVisibleItems(getUIntKey(elem, "visibleItems"));
+		menu->CacheDraw(getBoolKey(elem, "cache"));
 
 		if (elem.HasMember("onScrollDown"sv))
 		{
@@ -16,6 +16,7 @@ namespace Parser
 
 		sf::Vector2f size;
 		parseDrawableProperties(game, elem, *panel, size);
+		panel->CacheDraw(getBoolKey(elem, "cache"));
 
 		return panel;
 	}
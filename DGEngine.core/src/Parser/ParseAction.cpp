@@ -405,6 +405,10 @@ namespace Parser
 		{
 			return Actions::parseGameLoad(elem);
 		}
+		case str2int16("game.saveProfile"):
+		{
+			return Actions::parseGameSaveProfile(elem);
+		}
 		case str2int16("game.setGamma"):
 		{
 			return Actions::parseGameSetGamma(elem);
@@ -585,6 +589,10 @@ namespace Parser
 		{
 			return Actions::parseRandomList(game, elem);
 		}
+		case str2int16("random.seed"):
+		{
+			return Actions::parseRandomSeed(elem);
+		}
 		case str2int16("resource.add"):
 		{
 			return Actions::parseResourceAdd(elem);
@@ -11,6 +11,7 @@
 #include "ParseGameInputEvent.h"
 #include "ParseInputEvent.h"
 #include "ParseMountFile.h"
+#include "ParseRandom.h"
 #include "Parser/Drawables/ParseAnimation.h"
 #include "Parser/Drawables/ParseButton.h"
 #include "Parser/Drawables/ParseCircle.h"
@@ -36,6 +37,7 @@
 #include "Parser/Resources/ParseTexturePack.h"
 #include "ParseVariable.h"
 #include "Utils/ParseUtils.h"
+#include "Utils/Profiler.h"
 #include "Utils/StringHash.h"
 #include "Utils/Utils.h"
 
@@ -196,6 +198,8 @@ namespace Parser
 	void parseDocumentElem(Game& game, uint16_t nameHash16, const Value& elem,
 		ReplaceVars& replaceVars, MemoryPoolAllocator<CrtAllocator>& allocator)
 	{
+		PROFILE_ZONE("Parser::parseDocumentElem");
+
 		if (Hooks::ParseDocumentElem != nullptr &&
 			Hooks::ParseDocumentElem(game, nameHash16, elem, replaceVars, allocator) == true)
 		{
@@ -313,6 +317,11 @@ namespace Parser
 			parseDocumentElemArray(parsePanel, game, nameHash16, elem, replaceVars, allocator);
 			break;
 		}
+		case str2int16("random"):
+		{
+			parseDocumentElemArray(parseRandom, game, nameHash16, elem, replaceVars, allocator);
+			break;
+		}
 		case str2int16("rectangle"):
 		{
 			parseDocumentElemArray(parseRectangle, game, nameHash16, elem, replaceVars, allocator);
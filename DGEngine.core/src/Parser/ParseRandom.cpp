@@ -0,0 +1,37 @@
+#include "ParseRandom.h"
+#include "Game/Utils/GameUtils.h"
+#include "Utils/ParseUtils.h"
+#include "Utils/Random.h"
+
+namespace Parser
+{
+	using namespace rapidjson;
+	using namespace std::literals;
+
+	void parseRandom(Game& game, const Value& elem)
+	{
+		if (elem.HasMember("stream"sv) == false)
+		{
+			if (elem.HasMember("seed"sv) == true)
+			{
+				Random::seed(getUInt64Val(elem["seed"sv]));
+			}
+			return;
+		}
+
+		auto stream = GameUtils::getRandomStream(getStringViewVal(elem["stream"sv]), RandomStream::Size);
+		if (stream == RandomStream::Size)
+		{
+			return;
+		}
+		if (elem.HasMember("seed"sv) == true)
+		{
+			Random::seed(stream, getUInt64Val(elem["seed"sv]));
+		}
+		// restores a saved stream to where it was when saved
+		if (elem.HasMember("state"sv) == true)
+		{
+			Random::setState(stream, getUInt64Val(elem["state"sv]));
+		}
+	}
+}
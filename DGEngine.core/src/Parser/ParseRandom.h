@@ -0,0 +1,10 @@
+#pragma once
+
+#include "Json/JsonParser.h"
+
+class Game;
+
+namespace Parser
+{
+	void parseRandom(Game& game, const rapidjson::Value& elem);
+}
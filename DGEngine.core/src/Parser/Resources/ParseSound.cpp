@@ -322,17 +322,13 @@ namespace Parser
 
 		if (getBoolKey(elem, "play") == true)
 		{
-			sf::Sound sound(*sndBuffer);
-
 			auto volume = getVariableKey(elem, "volume");
 			auto vol = game.getVarOrProp<int64_t, unsigned>(volume, game.SoundVolume());
 			if (vol > 100)
 			{
 				vol = 100;
 			}
-			sound.setVolume((float)vol);
-
-			game.Resources().addPlayingSound(sound);
+			game.Resources().addPlayingSound(*sndBuffer, (float)vol);
 		}
 	}
 
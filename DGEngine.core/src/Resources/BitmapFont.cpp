@@ -2,6 +2,7 @@
 #include <cmath>
 #include "Resources/TexturePack.h"
 #include <SFML/System/Utf.hpp>
+#include "Utils/StringHash.h"
 
 BitmapFont::BitmapFont(const std::shared_ptr<TexturePack>& texturePack_,
 	int16_t newLine_, int16_t space_, int16_t tab_) : texturePack(texturePack_)
@@ -9,6 +10,23 @@ BitmapFont::BitmapFont(const std::shared_ptr<TexturePack>& texturePack_,
 	newLine = newLine_ < 0 ? texturePack_->getTextureSize('\n').x : newLine_;
 	space = space_ < 0 ? texturePack_->getTextureSize(' ').x : space_;
 	tab = tab_ < 0 ? texturePack_->getTextureSize('\t').x : tab_;
+
+	for (uint32_t i = 0; i < GlyphTableSize; i++)
+	{
+		glyphs[i] = resolveGlyph(i);
+	}
+}
+
+BitmapFontGlyph BitmapFont::resolveGlyph(uint32_t ch) const
+{
+	BitmapFontGlyph glyph;
+	TextureInfo ti;
+	if (texturePack->get(ch, ti) == true)
+	{
+		glyph.rect = ti.textureRect;
+	}
+	glyph.width = texturePack->getTextureSize(ch).x;
+	return glyph;
 }
 
 const Palette* BitmapFont::getPalette() const noexcept
@@ -67,7 +85,7 @@ float BitmapFont::calculateLineLength(std::string_view::const_iterator itBegin,
 		else
 		{
 			//Move over the width of the character
-			curX += (float)texturePack->getTextureSize(ch).x;
+			curX += (float)getGlyph(ch).width;
 		}
 		if (it < itEnd)
 		{
@@ -135,7 +153,7 @@ sf::Vector2f BitmapFont::calculateSize(const std::string_view text,
 			else
 			{
 				//Move over the width of the character
-				curX += (float)texturePack->getTextureSize(ch).x;
+				curX += (float)getGlyph(ch).width;
 			}
 			if (it < itEnd)
 			{
@@ -150,20 +168,48 @@ sf::Vector2f BitmapFont::calculateSize(const std::string_view text,
 	return sf::Vector2f(std::max(maxX, curX), (newLine + curY));
 }
 
+sf::Color BitmapFont::getVertexColor(const sf::Color& color) const noexcept
+{
+	if (hasPalette() == true)
+	{
+		return sf::Color::White;
+	}
+	else if (color == sf::Color::White)
+	{
+		return defaultColor;
+	}
+	return color;
+}
+
 void BitmapFont::updateVertexString(std::vector<sf::Vertex>& vertexText,
 	const std::string_view text, sf::Color color, int horizSpaceOffset,
 	int vertSpaceOffset, float sizeX, HorizontalAlign align) const
 {
 	horizSpaceOffset = getHorizontalSpaceOffset(horizSpaceOffset);
 	vertSpaceOffset = getHorizontalSpaceOffset(vertSpaceOffset);
-
-	if (hasPalette() == true)
+	color = getVertexColor(color);
+
+	BitmapFontLayoutQuery key;
+	key.hash = std::hash<std::string_view>{}(text);
+	hashCombine(key.hash, sizeX);
+	hashCombine(key.hash, horizSpaceOffset);
+	hashCombine(key.hash, vertSpaceOffset);
+	hashCombine(key.hash, (int)align);
+	key.text = text;
+	key.sizeX = sizeX;
+	key.horizSpaceOffset = horizSpaceOffset;
+	key.vertSpaceOffset = vertSpaceOffset;
+	key.align = align;
+
+	// same layout, only the color can be different
+	if (auto cachedVertexText = layoutCache.getValue(key))
 	{
-		color = sf::Color::White;
-	}
-	else if (color == sf::Color::White)
-	{
-		color = defaultColor;
+		vertexText = *cachedVertexText;
+		for (auto& vertex : vertexText)
+		{
+			vertex.color = color;
+		}
+		return;
 	}
 
 	vertexText.clear();
@@ -226,8 +272,8 @@ void BitmapFont::updateVertexString(std::vector<sf::Vertex>& vertexText,
 			else
 			{
 				//create the character vertex
-				TextureInfo ti;
-				texturePack->get(ch, ti);
+				auto glyph = getGlyph(ch);
+				const auto& textureRect = glyph.rect;
 
 				// triangle 1
 
@@ -235,21 +281,21 @@ void BitmapFont::updateVertexString(std::vector<sf::Vertex>& vertexText,
 				vertexText.push_back(sf::Vertex(
 					{ curX, curY },
 					color,
-					{ (float)ti.textureRect.left, (float)ti.textureRect.top }
+					{ (float)textureRect.left, (float)textureRect.top }
 				));
 
 				// top right
 				vertexText.push_back(sf::Vertex(
-					{ curX + (float)ti.textureRect.width, curY },
+					{ curX + (float)textureRect.width, curY },
 					color,
-					{ (float)ti.textureRect.left + (float)ti.textureRect.width, (float)ti.textureRect.top }
+					{ (float)textureRect.left + (float)textureRect.width, (float)textureRect.top }
 				));
 
 				// bottom left
 				vertexText.push_back(sf::Vertex(
-					{ curX, curY + (float)ti.textureRect.height },
+					{ curX, curY + (float)textureRect.height },
 					color,
-					{ (float)ti.textureRect.left, (float)ti.textureRect.top + (float)ti.textureRect.height }
+					{ (float)textureRect.left, (float)textureRect.top + (float)textureRect.height }
 				));
 
 				// triangle 2
@@ -262,13 +308,13 @@ void BitmapFont::updateVertexString(std::vector<sf::Vertex>& vertexText,
 
 				// bottom right
 				vertexText.push_back(sf::Vertex(
-					{ curX + (float)ti.textureRect.width, curY + (float)ti.textureRect.height },
+					{ curX + (float)textureRect.width, curY + (float)textureRect.height },
 					color,
-					{ (float)ti.textureRect.left + (float)ti.textureRect.width, (float)ti.textureRect.top + (float)ti.textureRect.height }
+					{ (float)textureRect.left + (float)textureRect.width, (float)textureRect.top + (float)textureRect.height }
 				));
 
 				//Move over the width of the character
-				curX += (float)ti.textureRect.width;
+				curX += (float)textureRect.width;
 			}
 			if (it < itEnd)
 			{
@@ -276,6 +322,8 @@ void BitmapFont::updateVertexString(std::vector<sf::Vertex>& vertexText,
 			}
 		}
 	}
+
+	layoutCache.updateValue(BitmapFontLayoutKey(key), vertexText);
 }
 
 void BitmapFont::draw(const VertexArray2& vertexText,
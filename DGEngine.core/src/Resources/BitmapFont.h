@@ -1,19 +1,73 @@
 #pragma once
 
 #include "Game/Alignment.h"
+#include <array>
 #include <memory>
 #include "Palette.h"
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include "SFML/VertexArray2.h"
+#include <string>
 #include <string_view>
+#include "Utils/LRUCache.h"
 
 class TexturePack;
 
+struct BitmapFontGlyph
+{
+	sf::IntRect rect;
+	int width{ 0 };
+};
+
+// layout cache lookup key. doesn't own the text, so searching doesn't allocate.
+struct BitmapFontLayoutQuery
+{
+	size_t hash{ 0 };
+	std::string_view text;
+	float sizeX{ 0.f };
+	int horizSpaceOffset{ 0 };
+	int vertSpaceOffset{ 0 };
+	HorizontalAlign align{ HorizontalAlign::Left };
+};
+
+struct BitmapFontLayoutKey
+{
+	size_t hash{ 0 };
+	std::string text;
+	float sizeX{ 0.f };
+	int horizSpaceOffset{ 0 };
+	int vertSpaceOffset{ 0 };
+	HorizontalAlign align{ HorizontalAlign::Left };
+
+	BitmapFontLayoutKey() = default;
+	BitmapFontLayoutKey(const BitmapFontLayoutQuery& query) : hash(query.hash),
+		text(query.text), sizeX(query.sizeX), horizSpaceOffset(query.horizSpaceOffset),
+		vertSpaceOffset(query.vertSpaceOffset), align(query.align) {}
+
+	bool operator==(const BitmapFontLayoutKey&) const = default;
+
+	// the text is only compared if everything else matches.
+	bool operator==(const BitmapFontLayoutQuery& query) const noexcept
+	{
+		return hash == query.hash &&
+			sizeX == query.sizeX &&
+			horizSpaceOffset == query.horizSpaceOffset &&
+			vertSpaceOffset == query.vertSpaceOffset &&
+			align == query.align &&
+			text == query.text;
+	}
+};
+
 class BitmapFont
 {
 protected:
+	static constexpr size_t GlyphTableSize = 256;
+
 	std::shared_ptr<TexturePack> texturePack;
+	// texture rects and widths of the first GlyphTableSize characters
+	std::array<BitmapFontGlyph, GlyphTableSize> glyphs;
+	// last laid out strings
+	mutable LRUCache<BitmapFontLayoutKey, std::vector<sf::Vertex>, 16> layoutCache;
 	std::shared_ptr<Palette> palette;
 	sf::Color defaultColor{ sf::Color::White };
 	int newLine{ 0 };
@@ -22,6 +76,13 @@ protected:
 	int defaultHorizSpaceOffset{ 0 };
 	int defaultVertSpaceOffset{ 0 };
 
+	BitmapFontGlyph resolveGlyph(uint32_t ch) const;
+
+	BitmapFontGlyph getGlyph(uint32_t ch) const
+	{
+		return ch < GlyphTableSize ? glyphs[ch] : resolveGlyph(ch);
+	}
+
 	float calculateLineLength(std::string_view::const_iterator it,
 		std::string_view::const_iterator itEnd, int horizSpaceOffset) const;
 
@@ -47,6 +108,9 @@ public:
 	sf::Vector2f calculateSize(const std::string_view text,
 		int horizSpaceOffset, int vertSpaceOffset, unsigned* lineCount = nullptr) const;
 
+	// color used for the vertices of a string drawn with the given color
+	sf::Color getVertexColor(const sf::Color& color) const noexcept;
+
 	void updateVertexString(std::vector<sf::Vertex>& vertexText,
 		const std::string_view text, sf::Color color, int horizSpaceOffset,
 		int vertSpaceOffset, float sizeX, HorizontalAlign align) const;
@@ -73,6 +73,7 @@ void Palette::loadTexture()
 void Palette::updateTexture()
 {
 	texture.update((const sf::Uint8*)&palette, (unsigned)palette.size(), 1, 0, 0);
+	version++;
 }
 
 bool Palette::shiftLeft(size_t shift, size_t startIdx, size_t stopIdx)
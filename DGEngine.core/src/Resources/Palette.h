@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <SFML/Graphics/Texture.hpp>
 #include <string_view>
 #include <vector>
@@ -17,6 +18,9 @@ public:
 	sf::Texture texture;
 	PaletteArray palette;
 
+	// bumped every time the colors change, so cached draws can detect in place edits.
+	uint32_t version{ 0 };
+
 	enum class ColorFormat
 	{
 		RGB,
@@ -32,6 +36,7 @@ public:
 	Palette(const Palette& pal, const std::vector<sf::Uint8> trn, size_t start, size_t length);
 
 	auto& operator[](size_t index) const noexcept { return palette[index]; }
+	auto Version() const noexcept { return version; }
 
 	bool shiftLeft(size_t shift, size_t startIdx, size_t stopIdx);
 	bool shiftRight(size_t shift, size_t startIdx, size_t stopIdx);
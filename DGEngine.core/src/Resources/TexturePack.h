@@ -32,6 +32,9 @@ public:
 
 	virtual void update(int epoch, sf::Time elapsedTime) {}
 
+	// true if get can return a different texture for the same index after an update.
+	virtual bool isAnimated() const noexcept { return false; }
+
 	// returns a texture only if the same texture is used for all calls to get
 	// returns nullptr if more than one texture is used
 	virtual const sf::Texture* getTexture() const noexcept { return nullptr; }
@@ -37,6 +37,8 @@ public:
 
 	void update(int epoch, sf::Time elapsedTime) override;
 
+	bool isAnimated() const noexcept override { return animatedTextures.empty() == false; }
+
 	TexturePack* getTexturePack() const noexcept { return texturePack.get(); }
 
 	void addAnimatedTexture(uint32_t animIndex, sf::Time refresh, const std::vector<uint32_t>& indexes);
@@ -1,4 +1,5 @@
 #include "CompositeSprite.h"
+#include "Utils/StringHash.h"
 
 CompositeSprite::CompositeSprite(const TextureInfo& ti)
 {
@@ -10,6 +11,37 @@ CompositeSprite::CompositeSprite(const std::vector<TextureInfo>& ti, bool drawAf
 	setTexture(ti, drawAfter);
 }
 
+static void getSpriteDrawHash(const Sprite2& sprite, size_t& hash)
+{
+	const auto& pos = sprite.getDrawPosition();
+	const auto& rect = sprite.getTextureRect();
+	hashCombine(hash, pos.x);
+	hashCombine(hash, pos.y);
+	hashCombine(hash, sprite.getTexture());
+	hashCombine(hash, rect.left);
+	hashCombine(hash, rect.top);
+	hashCombine(hash, rect.width);
+	hashCombine(hash, rect.height);
+	hashCombine(hash, sprite.getColor().toInteger());
+	hashCombine(hash, sprite.getPalette().get());
+	if (sprite.getPalette() != nullptr)
+	{
+		hashCombine(hash, sprite.getPalette()->Version());
+	}
+	hashCombine(hash, sprite.isOutlineEnabled());
+	hashCombine(hash, sprite.getOutline().toInteger());
+}
+
+void CompositeSprite::getDrawHash(size_t& hash) const
+{
+	getSpriteDrawHash(sprite, hash);
+	for (const auto& s : extraSprites)
+	{
+		getSpriteDrawHash(s, hash);
+	}
+	hashCombine(hash, drawAfterExtraSprites);
+}
+
 void CompositeSprite::setPosition(const sf::Vector2f& position_)
 {
 	sprite.setPosition(position_);
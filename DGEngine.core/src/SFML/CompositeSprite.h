@@ -37,6 +37,7 @@ public:
 	auto& getPalette() const noexcept { return sprite.getPalette(); }
 	void setPalette(const std::shared_ptr<Palette>& palette) noexcept { sprite.setPalette(palette); }
 
+	auto& getColor() const { return sprite.getColor(); }
 	void setColor(const sf::Color& color);
 	void setOrigin(const sf::Vector2f& origin) { sprite.setOrigin(origin); }
 
@@ -55,6 +56,9 @@ public:
 	void setTexture(const std::vector<TextureInfo>& ti, bool drawAfter = false);
 	void setTexture(const TextureInfoVar& ti);
 
+	// combines into hash everything that changes how the sprite is drawn.
+	void getDrawHash(size_t& hash) const;
+
 	void draw(sf::RenderTarget& target, GameShader* spriteShader) const;
 
 	void draw(sf::RenderTarget& target, GameShader* spriteShader,
@@ -1,5 +1,6 @@
 #include "Sprite2.h"
 #include "SFMLUtils.h"
+#include "Utils/Profiler.h"
 #include "Utils/StringHash.h"
 
 void Sprite2::setPosition(const sf::Vector2f& position_)
@@ -170,5 +171,6 @@ void Sprite2::draw(sf::RenderTarget& target, GameShader* spriteShader,
 			}
 		}
 	}
+	PROFILE_DRAW(getTexture());
 	target.draw(static_cast<sf::Sprite>(*this), states);
 }
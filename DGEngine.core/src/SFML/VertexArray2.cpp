@@ -1,5 +1,6 @@
 #include "VertexArray2.h"
 #include <SFML/Graphics/VertexArray.hpp>
+#include "Utils/Profiler.h"
 #include "Utils/StringHash.h"
 
 void VertexArray2::draw(const sf::Texture* texture, const Palette* palette,
@@ -47,6 +48,7 @@ void VertexArray2::draw(const sf::Texture* texture, const Palette* palette,
 			}
 		}
 	}
+	PROFILE_DRAW(texture);
 	target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, states);
 }
 
@@ -130,6 +130,26 @@ namespace sfe
 		return m_impl->setPlayingOffset(targetSeekTime);
 	}
 
+	uint64_t Movie::getDroppedFrameCount() const
+	{
+		return m_impl->getDroppedFrameCount();
+	}
+
+	uint64_t Movie::getLateFrameCount() const
+	{
+		return m_impl->getLateFrameCount();
+	}
+
+	uint64_t Movie::getDecodedFrameCount() const
+	{
+		return m_impl->getDecodedFrameCount();
+	}
+
+	uint64_t Movie::getDisplayedFrameCount() const
+	{
+		return m_impl->getDisplayedFrameCount();
+	}
+
 	const sf::Texture& Movie::getCurrentImage() const
 	{
 		return m_impl->getCurrentImage();
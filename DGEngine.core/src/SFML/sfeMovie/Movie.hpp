@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Transformable.hpp>
@@ -202,6 +203,22 @@ namespace sfe
 		 */
 		bool setPlayingOffset(const sf::Time& targetSeekTime);
 
+		/** @brief Returns the amount of video frames skipped to keep up with the playing position
+		 */
+		uint64_t getDroppedFrameCount() const;
+
+		/** @brief Returns the amount of video frames displayed after their presentation time
+		 */
+		uint64_t getLateFrameCount() const;
+
+		/** @brief Returns the amount of video frames decoded by the decoding thread
+		 */
+		uint64_t getDecodedFrameCount() const;
+
+		/** @brief Returns the amount of video frames shown
+		 */
+		uint64_t getDisplayedFrameCount() const;
+
 		/** @brief Returns the latest movie image
 		 *
 		 * The returned image is a texture in VRAM.
@@ -410,6 +410,58 @@ namespace sfe
 		return seekingResult;
 	}
 
+	uint64_t MovieImpl::getDroppedFrameCount() const
+	{
+		if (m_demuxer != nullptr)
+		{
+			auto videoStream = m_demuxer->getSelectedVideoStream();
+			if (videoStream != nullptr)
+			{
+				return videoStream->getDroppedFrameCount();
+			}
+		}
+		return 0;
+	}
+
+	uint64_t MovieImpl::getLateFrameCount() const
+	{
+		if (m_demuxer != nullptr)
+		{
+			auto videoStream = m_demuxer->getSelectedVideoStream();
+			if (videoStream != nullptr)
+			{
+				return videoStream->getLateFrameCount();
+			}
+		}
+		return 0;
+	}
+
+	uint64_t MovieImpl::getDecodedFrameCount() const
+	{
+		if (m_demuxer != nullptr)
+		{
+			auto videoStream = m_demuxer->getSelectedVideoStream();
+			if (videoStream != nullptr)
+			{
+				return videoStream->getDecodedFrameCount();
+			}
+		}
+		return 0;
+	}
+
+	uint64_t MovieImpl::getDisplayedFrameCount() const
+	{
+		if (m_demuxer != nullptr)
+		{
+			auto videoStream = m_demuxer->getSelectedVideoStream();
+			if (videoStream != nullptr)
+			{
+				return videoStream->getDisplayedFrameCount();
+			}
+		}
+		return 0;
+	}
+
 	const sf::Texture& MovieImpl::getCurrentImage() const
 	{
 		static sf::Texture emptyTexture;
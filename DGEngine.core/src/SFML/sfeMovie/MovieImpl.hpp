@@ -118,6 +118,22 @@ namespace sfe
 		 */
 		bool setPlayingOffset(const sf::Time& targetSeekTime);
 
+		/** @see Movie::getDroppedFrameCount()
+		 */
+		uint64_t getDroppedFrameCount() const;
+
+		/** @see Movie::getLateFrameCount()
+		 */
+		uint64_t getLateFrameCount() const;
+
+		/** @see Movie::getDecodedFrameCount()
+		 */
+		uint64_t getDecodedFrameCount() const;
+
+		/** @see Movie::getDisplayedFrameCount()
+		 */
+		uint64_t getDisplayedFrameCount() const;
+
 		/** @see Movie::getCurrentImage()
 		 */
 		const sf::Texture& getCurrentImage() const;
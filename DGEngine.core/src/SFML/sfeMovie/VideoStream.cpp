@@ -57,11 +57,26 @@ namespace sfe
 			return;
 		}
 
+		// decoded frames waiting to be displayed
+		for (auto& frame : m_frames)
+		{
+			frame.pixels.resize((size_t)m_rgbaVideoLinesize[0] * m_stream->codecpar->height);
+		}
+
 		initRescaler();
 	}
 
 	VideoStream::~VideoStream()
 	{
+		if (m_decodeThread.joinable() == true)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_queueMutex);
+				m_exitThread = true;
+			}
+			m_queueCondition.notify_all();
+			m_decodeThread.join();
+		}
 		if (m_rawVideoFrame != nullptr)
 		{
 			AVFunc::av_frame_free(&m_rawVideoFrame);
@@ -111,39 +126,153 @@ namespace sfe
 
 	void VideoStream::update()
 	{
-		sf::Time gap;
-		bool couldComputeGap = false;
-		while (getStatus() == Playing &&
-			(couldComputeGap = getSynchronizationGap(gap)) &&
-			gap < sf::Time::Zero)
+		if (getStatus() != Playing)
 		{
-			if (onGetData(m_texture) == false)
+			setDecoding(false);
+			return;
+		}
+		setDecoding(true);
+
+		auto offset = m_timer->getOffset();
+		Frame* frame = nullptr;
+		bool endOfStream = false;
+		{
+			std::lock_guard<std::mutex> lock(m_queueMutex);
+
+			// skip the frames that already have a due successor
+			while (m_queueCount > 1 &&
+				m_frames[(m_queueHead + 1) % FrameQueueSize].timestamp <= offset)
 			{
-				setStatus(Stopped);
+				m_queueHead = (m_queueHead + 1) % FrameQueueSize;
+				m_queueCount--;
+				m_droppedFrames++;
 			}
-			else
+			if (m_queueCount > 0 && m_frames[m_queueHead].timestamp <= offset)
 			{
-				static const sf::Time skipFrameThreshold(sf::milliseconds(50));
-				if (getSynchronizationGap(gap) && gap + skipFrameThreshold >= sf::Time::Zero)
-				{
-					m_delegate.didUpdateVideo(*this, m_texture);
-				}
+				frame = &m_frames[m_queueHead];
 			}
+			endOfStream = (m_endOfStream == true && m_queueCount == 0);
 		}
-		if (!couldComputeGap)
+		if (frame != nullptr)
 		{
+			// the worker never writes to queued frames, so this can be done unlocked
+			static const sf::Time lateFrameThreshold(sf::milliseconds(50));
+			if (frame->timestamp + lateFrameThreshold < offset)
+			{
+				m_lateFrames++;
+			}
+			m_texture.update(frame->pixels.data());
+			m_displayedFrames++;
+			m_delegate.didUpdateVideo(*this, m_texture);
+			{
+				std::lock_guard<std::mutex> lock(m_queueMutex);
+				m_queueHead = (m_queueHead + 1) % FrameQueueSize;
+				m_queueCount--;
+			}
+			m_queueCondition.notify_one();
+		}
+		else if (endOfStream == true)
+		{
+			setDecoding(false);
 			setStatus(Stopped);
 		}
 	}
 
+	void VideoStream::setDecoding(bool decoding)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_queueMutex);
+			if (m_decoding == decoding)
+			{
+				return;
+			}
+			m_decoding = decoding;
+		}
+		if (decoding == true && m_decodeThread.joinable() == false)
+		{
+			m_decodeThread = std::thread(&VideoStream::decodeLoop, this);
+		}
+		m_queueCondition.notify_one();
+	}
+
+	void VideoStream::stopDecoding()
+	{
+		setDecoding(false);
+		std::lock_guard<std::mutex> decodeLock(m_decodeMutex);
+	}
+
+	void VideoStream::clearFrameQueue()
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_decoding = false;
+		m_endOfStream = false;
+		m_queueHead = 0;
+		m_queueCount = 0;
+	}
+
+	void VideoStream::decodeLoop()
+	{
+		auto canDecode = [this]()
+		{
+			return m_decoding == true &&
+				m_endOfStream == false &&
+				m_queueCount < FrameQueueSize;
+		};
+
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_queueMutex);
+				m_queueCondition.wait(lock, [&]() { return m_exitThread == true || canDecode() == true; });
+				if (m_exitThread == true)
+				{
+					return;
+				}
+			}
+
+			std::lock_guard<std::mutex> decodeLock(m_decodeMutex);
+			Frame* frame = nullptr;
+			{
+				// the queue may have been flushed while waiting for the decoder
+				std::lock_guard<std::mutex> lock(m_queueMutex);
+				if (canDecode() == false)
+				{
+					continue;
+				}
+				frame = &m_frames[(m_queueHead + m_queueCount) % FrameQueueSize];
+			}
+
+			uint8_t* outVideoBuffer[4] = { frame->pixels.data() };
+			bool gotFrame = false;
+			bool goOn = decodeFrame(outVideoBuffer, frame->timestamp, gotFrame);
+			{
+				std::lock_guard<std::mutex> lock(m_queueMutex);
+				if (gotFrame == true)
+				{
+					m_queueCount++;
+					m_decodedFrames++;
+				}
+				if (goOn == false)
+				{
+					m_endOfStream = true;
+				}
+			}
+		}
+	}
+
 	void VideoStream::flushBuffers()
 	{
-		m_codecBufferingDelays.clear();
+		std::lock_guard<std::mutex> decodeLock(m_decodeMutex);
+		clearFrameQueue();
+		m_lastTimestamp = sf::Time::Zero;
 		Stream::flushBuffers();
 	}
 
 	bool VideoStream::fastForward(sf::Time targetPosition)
 	{
+		std::lock_guard<std::mutex> decodeLock(m_decodeMutex);
+		clearFrameQueue();
+
 		sf::Time position;
 		bool couldGetPosition = false;
 		while ((couldGetPosition = computeEncodedPosition(position)) &&
@@ -160,14 +289,28 @@ namespace sfe
 
 	void VideoStream::preload()
 	{
+		std::lock_guard<std::mutex> decodeLock(m_decodeMutex);
+		clearFrameQueue();
 		onGetData(m_texture);
 	}
 
 	bool VideoStream::onGetData(sf::Texture& texture)
 	{
-		AVPacket* packet = popEncodedData();
+		sf::Time timestamp;
 		bool gotFrame = false;
+		bool goOn = decodeFrame(m_rgbaVideoBuffer, timestamp, gotFrame);
+		if (gotFrame == true)
+		{
+			texture.update(m_rgbaVideoBuffer[0]);
+		}
+		return goOn;
+	}
+
+	bool VideoStream::decodeFrame(uint8_t* outVideoBuffer[4], sf::Time& timestamp, bool& gotFrame)
+	{
+		AVPacket* packet = popEncodedData();
 		bool goOn = false;
+		gotFrame = false;
 
 		if (packet != nullptr)
 		{
@@ -183,22 +326,8 @@ namespace sfe
 
 				if (gotFrame)
 				{
-					rescale(m_rawVideoFrame, m_rgbaVideoBuffer, m_rgbaVideoLinesize);
-					texture.update(m_rgbaVideoBuffer[0]);
-				}
-
-				if (!gotFrame && goOn)
-				{
-					// Decoding went fine but did not produce an image. This means the decoder is working in
-					// a pipelined way and wants more packets to output a full image. When the first full image will
-					// be generated, the encoded data queue head pts will be late compared to the generated image pts
-					// To take that into account we accumulate this time difference for reuse in getSynchronizationGap()
-					m_codecBufferingDelays.push_back(packetDuration(packet));
-
-					if (m_codecBufferingDelays.size() > (size_t)m_stream->codecpar->video_delay)
-					{
-						m_codecBufferingDelays.pop_front();
-					}
+					rescale(m_rawVideoFrame, outVideoBuffer, m_rgbaVideoLinesize);
+					timestamp = frameTimestamp(packet);
 				}
 
 				if (needsMoreDecoding)
@@ -220,18 +349,20 @@ namespace sfe
 		return goOn;
 	}
 
-	bool VideoStream::getSynchronizationGap(sf::Time& gap)
+	sf::Time VideoStream::frameTimestamp(const AVPacket* packet)
 	{
-		sf::Time position;
-		if (computeEncodedPosition(position) == true)
+		int64_t timestamp = m_rawVideoFrame->best_effort_timestamp;
+		if (timestamp != AV_NOPTS_VALUE)
 		{
-			gap = (position - codecBufferingDelay()) - m_timer->getOffset();
-			return true;
+			int64_t startTime = m_stream->start_time != AV_NOPTS_VALUE ? m_stream->start_time : 0;
+			m_lastTimestamp = sf::seconds((float)((timestamp - startTime) * av_q2d(m_stream->time_base)));
 		}
 		else
 		{
-			return false;
+			// no timestamp, assume frames are evenly spaced
+			m_lastTimestamp += packetDuration(packet);
 		}
+		return m_lastTimestamp;
 	}
 
 	bool VideoStream::decodePacket(AVPacket* packet, AVFrame* outputFrame, bool& gotFrame, bool& needsMoreDecoding)
@@ -292,13 +423,15 @@ namespace sfe
 		}
 	}
 
-	sf::Time VideoStream::codecBufferingDelay() const
+	void VideoStream::didPause(const Timer& timer, Status previousStatus)
 	{
-		sf::Time delay;
-		for (const auto& packetDelay : m_codecBufferingDelays)
-		{
-			delay += packetDelay;
-		}
-		return delay;
+		Stream::didPause(timer, previousStatus);
+		stopDecoding();
+	}
+
+	void VideoStream::didStop(const Timer& timer, Status previousStatus)
+	{
+		Stream::didStop(timer, previousStatus);
+		stopDecoding();
 	}
 }
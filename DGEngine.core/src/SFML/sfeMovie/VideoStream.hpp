@@ -23,9 +23,15 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 #include <SFML/Graphics/Texture.hpp>
 #include "Stream.hpp"
+#include <thread>
+#include <vector>
 
 namespace sfe
 {
@@ -73,9 +79,28 @@ namespace sfe
 		sf::Texture& getVideoTexture();
 
 		/** Update the video frame and the stream's status
+		 *
+		 * Decoding and colour conversion run on a worker thread, this only
+		 * picks the queued frame matching the timer and uploads it
 		 */
 		void update() override;
 
+		/** Get the amount of decoded frames that were skipped because a later frame was already due
+		 */
+		uint64_t getDroppedFrameCount() const noexcept { return m_droppedFrames; }
+
+		/** Get the amount of frames that were displayed later than their presentation time
+		 */
+		uint64_t getLateFrameCount() const noexcept { return m_lateFrames; }
+
+		/** Get the amount of frames decoded by the worker thread
+		 */
+		uint64_t getDecodedFrameCount() const noexcept { return m_decodedFrames; }
+
+		/** Get the amount of frames uploaded to the texture by update()
+		 */
+		uint64_t getDisplayedFrameCount() const noexcept { return m_displayedFrames; }
+
 		/** @see Stream::flushBuffers()
 		 */
 		void flushBuffers() override;
@@ -92,17 +117,43 @@ namespace sfe
 		 */
 		bool hasError() const noexcept override;
 	private:
+		struct Frame
+		{
+			std::vector<uint8_t> pixels;
+			sf::Time timestamp;
+		};
+
+		static constexpr size_t FrameQueueSize = 4;
+
 		bool onGetData(sf::Texture& texture);
 
-		/** Returns the difference between the video stream timer and the reference timer
-		 *
-		 * A positive value means the video stream is ahead of the reference timer
-		 * whereas a nevatige value means the video stream is late
+		/** Decode the next frame into @a outVideoBuffer as RGBA image data
 		 *
-		 * @param[out] gap the gap, if it could be computed
-		 * @return true if the gap could be computed, false otherwise (@ref gap is left unmodified)
+		 * @param[out] timestamp the presentation time of the decoded frame
+		 * @param[out] gotFrame set to true if a frame was decoded
+		 * @return true if decoding can continue, false otherwise (EOF)
 		 */
-		bool getSynchronizationGap(sf::Time& gap);
+		bool decodeFrame(uint8_t* outVideoBuffer[4], sf::Time& timestamp, bool& gotFrame);
+
+		/** Get the presentation time of the last decoded frame
+		 */
+		sf::Time frameTimestamp(const AVPacket* packet);
+
+		/** Worker thread loop that fills the frame queue while decoding is enabled
+		 */
+		void decodeLoop();
+
+		/** Enable or disable the worker thread, starting it if needed
+		 */
+		void setDecoding(bool decoding);
+
+		/** Disable the worker thread and wait for the frame being decoded, if any
+		 */
+		void stopDecoding();
+
+		/** Drop all queued frames and disable the worker thread until the next update
+		 */
+		void clearFrameQueue();
 
 		/** Decode the encoded data @a packet into @a outputFrame
 		 *
@@ -135,19 +186,34 @@ namespace sfe
 
 		// Timer::Observer interface
 		void willPlay(const Timer& timer) override;
-
-		/** Returns the delay caused by the FFmpeg decoder buffering
-		 */
-		sf::Time codecBufferingDelay() const;
+		void didPause(const Timer& timer, Status previousStatus) override;
+		void didStop(const Timer& timer, Status previousStatus) override;
 
 		// Private data
 		sf::Texture m_texture;
 		AVFrame* m_rawVideoFrame{ nullptr };
 		uint8_t* m_rgbaVideoBuffer[4]{};
 		int m_rgbaVideoLinesize[4]{};
-		std::list<sf::Time> m_codecBufferingDelays;
+		sf::Time m_lastTimestamp;
 		Delegate& m_delegate;
 
+		// Decoding thread data
+		std::thread m_decodeThread;
+		// held while decoding a frame, used to keep the worker out of flushing and seeking
+		std::mutex m_decodeMutex;
+		std::mutex m_queueMutex;
+		std::condition_variable m_queueCondition;
+		std::array<Frame, FrameQueueSize> m_frames;
+		size_t m_queueHead{ 0 };
+		size_t m_queueCount{ 0 };
+		bool m_decoding{ false };
+		bool m_endOfStream{ false };
+		bool m_exitThread{ false };
+		uint64_t m_droppedFrames{ 0 };
+		uint64_t m_lateFrames{ 0 };
+		uint64_t m_displayedFrames{ 0 };
+		std::atomic<uint64_t> m_decodedFrames{ 0 };
+
 		// Rescaler data
 		struct SwsContext* m_swsCtx{ nullptr };
 	};
@@ -8,7 +8,9 @@ class LRUCache : protected FixedMap<Key_, Val_, Size_>
 public:
 	// if value exists, it gets moved to the top.
 	// reference only valid until the next LRUCache call.
-	bool getValue(const Key_& key, Val_& value) noexcept
+	// key can be of any type comparable to Key_ (to avoid building a Key_ to search).
+	template <class Key2_ = Key_>
+	bool getValue(const Key2_& key, Val_& value) noexcept
 	{
 		for (size_t i = 0; i < this->numElements; i++)
 		{
@@ -30,7 +32,8 @@ public:
 
 	// if value exists, it gets moved to the top.
 	// pointer only valid until the next LRUCache call.
-	Val_* getValue(const Key_& key) noexcept
+	template <class Key2_ = Key_>
+	Val_* getValue(const Key2_& key) noexcept
 	{
 		for (size_t i = 0; i < this->numElements; i++)
 		{
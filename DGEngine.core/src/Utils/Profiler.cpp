@@ -0,0 +1,209 @@
+#include "Profiler.h"
+
+#ifdef DGENGINE_PROFILER
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct ZoneEvent
+	{
+		const char* name{ nullptr };
+		int64_t start{ 0 };
+		int64_t duration{ 0 };
+		uint32_t threadId{ 0 };
+	};
+
+	struct ZoneStats
+	{
+		const char* name{ nullptr };
+		int64_t duration{ 0 };
+		uint32_t calls{ 0 };
+	};
+
+	std::array<ZoneEvent, Profiler::EventBufferSize> zoneEvents;
+	std::atomic<uint64_t> numZoneEvents{ 0 };
+	std::atomic<uint32_t> numThreads{ 0 };
+
+	std::array<std::atomic<uint32_t>, (size_t)ProfilerCounter::Size> counters{};
+	std::array<uint32_t, (size_t)ProfilerCounter::Size> lastFrameCounters{};
+	std::vector<ZoneStats> lastFrameZones;
+	uint64_t frameFirstEvent{ 0 };
+	int64_t frameStart{ 0 };
+	int64_t lastFrameDuration{ 0 };
+	const void* lastDrawTexture{ nullptr };
+
+	uint32_t getThreadId() noexcept
+	{
+		thread_local uint32_t threadId = numThreads++;
+		return threadId;
+	}
+}
+
+int64_t Profiler::now() noexcept
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Profiler::addZone(const char* name, int64_t start, int64_t end) noexcept
+{
+	auto idx = numZoneEvents.fetch_add(1, std::memory_order_relaxed);
+	auto& evt = zoneEvents[idx % EventBufferSize];
+	evt.name = name;
+	evt.start = start;
+	evt.duration = end - start;
+	evt.threadId = getThreadId();
+}
+
+void Profiler::count(ProfilerCounter counter, uint32_t amount) noexcept
+{
+	counters[(size_t)counter].fetch_add(amount, std::memory_order_relaxed);
+}
+
+void Profiler::countDraw(const void* texture) noexcept
+{
+	count(ProfilerCounter::DrawCalls);
+	if (texture != lastDrawTexture)
+	{
+		lastDrawTexture = texture;
+		count(ProfilerCounter::TextureBinds);
+	}
+}
+
+void Profiler::newFrame() noexcept
+{
+	auto frameEnd = now();
+	if (frameStart != 0)
+	{
+		lastFrameDuration = frameEnd - frameStart;
+	}
+	frameStart = frameEnd;
+
+	for (size_t i = 0; i < counters.size(); i++)
+	{
+		lastFrameCounters[i] = counters[i].exchange(0, std::memory_order_relaxed);
+	}
+	lastDrawTexture = nullptr;
+
+	auto lastEvent = numZoneEvents.load(std::memory_order_relaxed);
+	auto firstEvent = std::max(frameFirstEvent, lastEvent > EventBufferSize ? lastEvent - EventBufferSize : 0);
+	frameFirstEvent = lastEvent;
+
+	lastFrameZones.clear();
+	for (auto i = firstEvent; i < lastEvent; i++)
+	{
+		const auto& evt = zoneEvents[i % EventBufferSize];
+		auto it = std::find_if(lastFrameZones.begin(), lastFrameZones.end(),
+			[&evt](const ZoneStats& stats) { return stats.name == evt.name; });
+		if (it == lastFrameZones.end())
+		{
+			lastFrameZones.push_back({ evt.name, evt.duration, 1 });
+		}
+		else
+		{
+			it->duration += evt.duration;
+			it->calls++;
+		}
+	}
+	std::sort(lastFrameZones.begin(), lastFrameZones.end(),
+		[](const ZoneStats& a, const ZoneStats& b) { return a.duration > b.duration; });
+}
+
+double Profiler::getLastFrameTime() noexcept
+{
+	return (double)lastFrameDuration / 1000000.0;
+}
+
+uint32_t Profiler::getLastFrameCounter(ProfilerCounter counter) noexcept
+{
+	return lastFrameCounters[(size_t)counter];
+}
+
+std::string Profiler::getLastFrameSummary()
+{
+	std::string str;
+	char buffer[256];
+	std::snprintf(buffer, sizeof(buffer),
+		"frame: %.2f ms\ndraw calls: %u\ntexture binds: %u\ntexture fetches: %u\nallocations: %u",
+		getLastFrameTime(),
+		getLastFrameCounter(ProfilerCounter::DrawCalls),
+		getLastFrameCounter(ProfilerCounter::TextureBinds),
+		getLastFrameCounter(ProfilerCounter::TextureFetches),
+		getLastFrameCounter(ProfilerCounter::Allocations));
+	str += buffer;
+	for (const auto& zone : lastFrameZones)
+	{
+		std::snprintf(buffer, sizeof(buffer), "\n%s: %.3f ms (%u)",
+			zone.name, (double)zone.duration / 1000000.0, zone.calls);
+		str += buffer;
+	}
+	return str;
+}
+
+std::string Profiler::getChromeTrace()
+{
+	auto lastEvent = numZoneEvents.load(std::memory_order_relaxed);
+	auto firstEvent = lastEvent > EventBufferSize ? lastEvent - EventBufferSize : 0;
+
+	std::string str = "{\"traceEvents\":[";
+	char buffer[256];
+	for (auto i = firstEvent; i < lastEvent; i++)
+	{
+		const auto& evt = zoneEvents[i % EventBufferSize];
+		std::snprintf(buffer, sizeof(buffer),
+			"%s\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%u}",
+			(i == firstEvent ? "" : ","),
+			evt.name,
+			(double)evt.start / 1000.0,
+			(double)evt.duration / 1000.0,
+			evt.threadId);
+		str += buffer;
+	}
+	str += "\n]}\n";
+	return str;
+}
+
+// count allocations
+
+void* operator new(std::size_t size)
+{
+	Profiler::count(ProfilerCounter::Allocations);
+	if (auto ptr = std::malloc(size == 0 ? 1 : size))
+	{
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+#else
+
+int64_t Profiler::now() noexcept { return 0; }
+void Profiler::addZone(const char* name, int64_t start, int64_t end) noexcept {}
+void Profiler::count(ProfilerCounter counter, uint32_t amount) noexcept {}
+void Profiler::countDraw(const void* texture) noexcept {}
+void Profiler::newFrame() noexcept {}
+double Profiler::getLastFrameTime() noexcept { return 0.0; }
+uint32_t Profiler::getLastFrameCounter(ProfilerCounter counter) noexcept { return 0; }
+std::string Profiler::getLastFrameSummary() { return {}; }
+std::string Profiler::getChromeTrace() { return {}; }
+
+#endif
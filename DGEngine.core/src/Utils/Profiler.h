@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// frame profiler. zones and counters are only recorded when compiled with DGENGINE_PROFILER,
+// otherwise the PROFILE_ macros compile to nothing and Profiler returns empty results.
+
+enum class ProfilerCounter : uint8_t
+{
+	DrawCalls,
+	TextureBinds,
+	TextureFetches,
+	Allocations,
+	Size
+};
+
+class Profiler
+{
+public:
+	// number of zone events kept (ring buffer).
+	static constexpr size_t EventBufferSize = 1 << 16;
+
+	static constexpr bool Enabled() noexcept
+	{
+#ifdef DGENGINE_PROFILER
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	// time in nanoseconds since an unspecified point.
+	static int64_t now() noexcept;
+
+	static void addZone(const char* name, int64_t start, int64_t end) noexcept;
+
+	static void count(ProfilerCounter counter, uint32_t amount = 1) noexcept;
+
+	// counts a draw call and a texture bind if the texture is different from the last draw's.
+	static void countDraw(const void* texture) noexcept;
+
+	// closes the current frame (updates last frame's values) and starts a new one.
+	static void newFrame() noexcept;
+
+	static double getLastFrameTime() noexcept;
+	static uint32_t getLastFrameCounter(ProfilerCounter counter) noexcept;
+
+	// last frame's counters and time per zone, one per line.
+	static std::string getLastFrameSummary();
+
+	// all zones in the ring buffer in Chrome's trace event format (chrome://tracing).
+	static std::string getChromeTrace();
+};
+
+#ifdef DGENGINE_PROFILER
+
+class ProfilerZone
+{
+private:
+	const char* name;
+	int64_t start;
+
+public:
+	ProfilerZone(const char* name_) noexcept : name(name_), start(Profiler::now()) {}
+	~ProfilerZone() { Profiler::addZone(name, start, Profiler::now()); }
+
+	ProfilerZone(const ProfilerZone&) = delete;
+	ProfilerZone& operator=(const ProfilerZone&) = delete;
+};
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+
+// name must be a string literal (it's stored as a pointer).
+#define PROFILE_ZONE(name) ProfilerZone PROFILE_CONCAT(profilerZone, __LINE__)(name)
+#define PROFILE_COUNT(counter) Profiler::count(counter)
+#define PROFILE_DRAW(texture) Profiler::countDraw(texture)
+#define PROFILE_NEW_FRAME() Profiler::newFrame()
+
+#else
+
+#define PROFILE_ZONE(name)
+#define PROFILE_COUNT(counter)
+#define PROFILE_DRAW(texture)
+#define PROFILE_NEW_FRAME()
+
+#endif
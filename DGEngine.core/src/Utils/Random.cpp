@@ -1,4 +1,80 @@
 #include "Random.h"
 
-std::random_device RandomGenerator::rd;
-std::mt19937 RandomGenerator::generator(rd());
+std::array<PCG32, (size_t)RandomStream::Size> RandomGenerator::generators;
+std::array<uint64_t, (size_t)RandomStream::Size> RandomGenerator::seeds;
+
+namespace
+{
+	struct RandomInitializer
+	{
+		RandomInitializer() { RandomGenerator::seed(); }
+	} randomInitializer;
+}
+
+uint64_t RandomGenerator::getBounded(PCG32& gen, uint64_t range) noexcept
+{
+	if (range == 0)
+	{
+		return 0;
+	}
+	else if (range < 0xFFFFFFFFull)
+	{
+		// Lemire's nearly divisionless method
+		auto s = (uint32_t)(range + 1);
+		auto m = (uint64_t)gen() * s;
+		auto l = (uint32_t)m;
+		if (l < s)
+		{
+			auto t = (0u - s) % s;
+			while (l < t)
+			{
+				m = (uint64_t)gen() * s;
+				l = (uint32_t)m;
+			}
+		}
+		return m >> 32;
+	}
+	auto mask = ~0ull;
+	while ((mask >> 1) >= range)
+	{
+		mask >>= 1;
+	}
+	uint64_t val;
+	do
+	{
+		val = (((uint64_t)gen() << 32) | gen()) & mask;
+	} while (val > range);
+	return val;
+}
+
+double RandomGenerator::getUnit(RandomStream stream) noexcept
+{
+	auto& gen = generator(stream);
+	auto val = ((uint64_t)gen() << 32) | gen();
+	return (double)(val >> 11) * 0x1.0p-53;
+}
+
+float RandomGenerator::getUnitf(RandomStream stream) noexcept
+{
+	return (float)(generator(stream)() >> 8) * 0x1.0p-24f;
+}
+
+void RandomGenerator::seed(uint64_t seed_) noexcept
+{
+	for (size_t i = 0; i < generators.size(); i++)
+	{
+		seed((RandomStream)i, seed_);
+	}
+}
+
+void RandomGenerator::seed(RandomStream stream, uint64_t seed_) noexcept
+{
+	seeds[(size_t)stream] = seed_;
+	generator(stream).seed(seed_, (uint64_t)stream);
+}
+
+void RandomGenerator::seed()
+{
+	std::random_device rd;
+	seed(((uint64_t)rd() << 32) | rd());
+}
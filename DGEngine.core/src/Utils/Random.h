@@ -1,12 +1,96 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <random>
+#include <type_traits>
+
+// independent random number streams. each stream can be seeded separately,
+// so that using one (ex: cosmetic effects) doesn't change the sequence of another (ex: loot).
+enum class RandomStream : uint8_t
+{
+	Default,
+	Level,
+	Loot,
+	Combat,
+	AI,
+	Cosmetic,
+	Size
+};
+
+// PCG32 (XSH RR) generator - https://www.pcg-random.org
+class PCG32
+{
+private:
+	uint64_t state{ 0x853c49e6748fea9bULL };
+	uint64_t inc{ 0xda3e39cb94b95bdbULL };
+
+public:
+	using result_type = uint32_t;
+
+	PCG32() = default;
+	PCG32(uint64_t seed_, uint64_t sequence = 0) noexcept { seed(seed_, sequence); }
+
+	void seed(uint64_t seed_, uint64_t sequence = 0) noexcept
+	{
+		state = 0;
+		inc = (sequence << 1) | 1;
+		(*this)();
+		state += seed_;
+		(*this)();
+	}
+
+	uint64_t getState() const noexcept { return state; }
+	void setState(uint64_t state_) noexcept { state = state_; }
+
+	static constexpr result_type min() noexcept { return 0; }
+	static constexpr result_type max() noexcept { return 0xFFFFFFFFu; }
+
+	result_type operator()() noexcept
+	{
+		auto oldState = state;
+		state = oldState * 6364136223846793005ULL + inc;
+		auto xorShifted = (uint32_t)(((oldState >> 18) ^ oldState) >> 27);
+		auto rot = (uint32_t)(oldState >> 59);
+		return (xorShifted >> rot) | (xorShifted << ((0u - rot) & 31));
+	}
+};
 
 class RandomGenerator
 {
 protected:
-	static std::random_device rd;
-	static std::mt19937 generator;
+	static std::array<PCG32, (size_t)RandomStream::Size> generators;
+	static std::array<uint64_t, (size_t)RandomStream::Size> seeds;
+
+	static PCG32& generator(RandomStream stream) noexcept { return generators[(size_t)stream]; }
+
+	// uniform number in [0, range]
+	static uint64_t getBounded(PCG32& gen, uint64_t range) noexcept;
+	static uint64_t getBounded(RandomStream stream, uint64_t range) noexcept
+	{
+		return getBounded(generator(stream), range);
+	}
+
+	// uniform number in [0, 1)
+	static double getUnit(RandomStream stream) noexcept;
+	static float getUnitf(RandomStream stream) noexcept;
+
+public:
+	// seeds all streams (each stream gets a different sequence for the same seed).
+	static void seed(uint64_t seed_) noexcept;
+	static void seed(RandomStream stream, uint64_t seed_) noexcept;
+
+	// seeds all streams with a non deterministic seed.
+	static void seed();
+
+	static uint64_t getSeed(RandomStream stream) noexcept { return seeds[(size_t)stream]; }
+
+	// generator of the stream, for functions that take the generator to use.
+	static PCG32& Generator(RandomStream stream) noexcept { return generator(stream); }
+
+	// current position of the stream (to save and restore it).
+	static uint64_t getState(RandomStream stream) noexcept { return generator(stream).getState(); }
+	static void setState(RandomStream stream, uint64_t state) noexcept { generator(stream).setState(state); }
 };
 
 // uniform random number generator
@@ -14,61 +98,84 @@ class Random : public RandomGenerator
 {
 public:
 	template <class T>
-	static T get(T max)
+	static T get(RandomStream stream, T min, T max)
 	{
-		std::uniform_int_distribution<T> dist(0, max);
-		return dist(generator);
+		using U = std::make_unsigned_t<T>;
+		auto range = (uint64_t)(U)((U)max - (U)min);
+		return (T)((U)min + (U)getBounded(stream, range));
 	}
 
 	template <class T>
-	static T get(T min, T max)
+	static T get(PCG32& gen, T min, T max)
 	{
-		std::uniform_int_distribution<T> dist(min, max);
-		return dist(generator);
+		using U = std::make_unsigned_t<T>;
+		auto range = (uint64_t)(U)((U)max - (U)min);
+		return (T)((U)min + (U)getBounded(gen, range));
 	}
 
 	template <class T>
-	static T getf()
-	{
-		std::uniform_real_distribution<T> dist(0., 1.);
-		return dist(generator);
-	}
+	static T get(RandomStream stream, T max) { return get<T>(stream, 0, max); }
 
 	template <class T>
-	static T getf(T max)
-	{
-		std::uniform_real_distribution<T> dist(0., max);
-		return dist(generator);
-	}
+	static T get(T max) { return get<T>(RandomStream::Default, 0, max); }
 
 	template <class T>
-	static T getf(T min, T max)
+	static T get(T min, T max) { return get<T>(RandomStream::Default, min, max); }
+
+	template <class T>
+	static T getf(RandomStream stream)
 	{
-		std::uniform_real_distribution<T> dist(min, max);
-		return dist(generator);
+		if constexpr (std::is_same_v<T, float>)
+		{
+			return getUnitf(stream);
+		}
+		else
+		{
+			return (T)getUnit(stream);
+		}
 	}
+
+	template <class T>
+	static T getf(RandomStream stream, T max) { return getf<T>(stream) * max; }
+
+	template <class T>
+	static T getf(RandomStream stream, T min, T max) { return min + getf<T>(stream) * (max - min); }
+
+	template <class T>
+	static T getf() { return getf<T>(RandomStream::Default); }
+
+	template <class T>
+	static T getf(T max) { return getf<T>(RandomStream::Default, max); }
+
+	template <class T>
+	static T getf(T min, T max) { return getf<T>(RandomStream::Default, min, max); }
 };
 
 // normal distribution random number generator
 class RandomNormal : public RandomGenerator
 {
 public:
+	template <class T>
+	static T get(RandomStream stream, T mean, T stdDev)
+	{
+		std::normal_distribution<T> dist(mean, stdDev);
+		return dist(generator(stream));
+	}
+
 	template <class T>
 	static T get(T mean)
 	{
-		std::normal_distribution<T> dist(mean, 1);
-		return dist(generator);
+		return get<T>(RandomStream::Default, mean, 1);
 	}
 
 	template <class T>
 	static T get(T mean, T stdDev)
 	{
-		std::normal_distribution<T> dist(mean, stdDev);
-		return dist(generator);
+		return get<T>(RandomStream::Default, mean, stdDev);
 	}
 
 	template <class T>
-	static T getRange(T min, T mean, T max)
+	static T getRange(RandomStream stream, T min, T mean, T max)
 	{
 		T averageBoundWidth = ((mean - min) + (max - mean)) / 2.0;
 		T standardDeviation = averageBoundWidth / 3.0;
@@ -77,11 +184,17 @@ public:
 		T value;
 		do
 		{
-			value = distribution(generator);
+			value = distribution(generator(stream));
 		} while (value < min || max < value);
 		return value;
 	}
 
+	template <class T>
+	static T getRange(T min, T mean, T max)
+	{
+		return getRange<T>(RandomStream::Default, min, mean, max);
+	}
+
 	// returns a normal distributed number between 0 and num.
 	// num must be > 0
 	// example: 5000 x std::round(getRange(4.0))
@@ -91,7 +204,7 @@ public:
 	// 3 - 1047
 	// 4 - 52
 	template <class T>
-	static T getRange(T num)
+	static T getRange(RandomStream stream, T num)
 	{
 		T mean = num * 0.5;
 		T standardDeviation = mean / 3.0;
@@ -100,8 +213,14 @@ public:
 		T value;
 		do
 		{
-			value = distribution(generator);
+			value = distribution(generator(stream));
 		} while (value < 0.0 || num < value);
 		return value;
 	}
+
+	template <class T>
+	static T getRange(T num)
+	{
+		return getRange<T>(RandomStream::Default, num);
+	}
 };
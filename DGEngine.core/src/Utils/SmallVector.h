@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+// vector that stores up to Size_ elements inline and moves to the heap when it grows past that.
+// only for trivially copyable types.
+template <class Val_, size_t Size_>
+class SmallVector
+{
+	static_assert(std::is_trivially_copyable_v<Val_> == true);
+
+private:
+	std::array<Val_, Size_> inlineElements{};
+	std::vector<Val_> heapElements;
+	size_t numElements{ 0 };
+
+	constexpr bool onHeap() const noexcept { return numElements > Size_; }
+
+	void moveToHeap()
+	{
+		heapElements.assign(inlineElements.begin(), inlineElements.begin() + numElements);
+	}
+
+	void moveToInline()
+	{
+		std::copy(heapElements.begin(), heapElements.begin() + numElements, inlineElements.begin());
+		heapElements.clear();
+	}
+
+public:
+	Val_* data() noexcept { return onHeap() == true ? heapElements.data() : inlineElements.data(); }
+	const Val_* data() const noexcept { return onHeap() == true ? heapElements.data() : inlineElements.data(); }
+
+	auto begin() noexcept { return data(); }
+	auto end() noexcept { return data() + numElements; }
+	auto begin() const noexcept { return data(); }
+	auto end() const noexcept { return data() + numElements; }
+	auto cbegin() const noexcept { return data(); }
+	auto cend() const noexcept { return data() + numElements; }
+	auto rbegin() noexcept { return std::reverse_iterator(end()); }
+	auto rend() noexcept { return std::reverse_iterator(begin()); }
+	auto rbegin() const noexcept { return std::reverse_iterator(end()); }
+	auto rend() const noexcept { return std::reverse_iterator(begin()); }
+	auto crbegin() const noexcept { return std::reverse_iterator(cend()); }
+	auto crend() const noexcept { return std::reverse_iterator(cbegin()); }
+
+	bool empty() const noexcept { return numElements == 0; }
+	size_t size() const noexcept { return numElements; }
+
+	Val_& operator[](size_t idx) noexcept { return data()[idx]; }
+	const Val_& operator[](size_t idx) const noexcept { return data()[idx]; }
+
+	Val_& front() noexcept { return data()[0]; }
+	const Val_& front() const noexcept { return data()[0]; }
+	Val_& back() noexcept { return data()[numElements - 1]; }
+	const Val_& back() const noexcept { return data()[numElements - 1]; }
+
+	void insert(size_t idx, const Val_& val)
+	{
+		if (numElements < Size_)
+		{
+			std::copy_backward(inlineElements.begin() + idx,
+				inlineElements.begin() + numElements,
+				inlineElements.begin() + numElements + 1);
+			inlineElements[idx] = val;
+		}
+		else
+		{
+			if (numElements == Size_)
+			{
+				moveToHeap();
+			}
+			heapElements.insert(heapElements.begin() + idx, val);
+		}
+		numElements++;
+	}
+
+	void push_back(const Val_& val) { insert(numElements, val); }
+
+	void erase(size_t idx)
+	{
+		if (onHeap() == true)
+		{
+			heapElements.erase(heapElements.begin() + idx);
+			numElements--;
+			if (numElements == Size_)
+			{
+				moveToInline();
+			}
+		}
+		else
+		{
+			std::copy(inlineElements.begin() + idx + 1,
+				inlineElements.begin() + numElements,
+				inlineElements.begin() + idx);
+			numElements--;
+		}
+	}
+
+	void clear() noexcept
+	{
+		heapElements.clear();
+		numElements = 0;
+	}
+};
@@ -0,0 +1,118 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(size_t numThreads)
+{
+	if (numThreads == 0)
+	{
+		auto numCores = (size_t)std::thread::hardware_concurrency();
+		numThreads = numCores > 1 ? numCores - 1 : 0;
+	}
+	workers.reserve(numThreads);
+	for (size_t i = 0; i < numThreads; i++)
+	{
+		workers.emplace_back(&ThreadPool::workerLoop, this);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard lock(mutex);
+		stopping = true;
+	}
+	workAvailable.notify_all();
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPool::workerLoop()
+{
+	uint64_t lastGeneration = 0;
+	while (true)
+	{
+		const std::function<void(size_t)>* func = nullptr;
+		size_t count = 0;
+		size_t chunkSize = 0;
+		{
+			std::unique_lock lock(mutex);
+			workAvailable.wait(lock, [&] { return stopping == true || jobGeneration != lastGeneration; });
+			if (stopping == true)
+			{
+				return;
+			}
+			lastGeneration = jobGeneration;
+			if (job == nullptr)
+			{
+				// woke up after the job was already finished
+				continue;
+			}
+			func = job;
+			count = jobCount;
+			chunkSize = jobChunkSize;
+			activeWorkers++;
+		}
+		runChunks(*func, count, chunkSize);
+		{
+			std::lock_guard lock(mutex);
+			activeWorkers--;
+		}
+		workDone.notify_one();
+	}
+}
+
+void ThreadPool::runChunks(const std::function<void(size_t)>& func, size_t count, size_t chunkSize)
+{
+	while (true)
+	{
+		auto start = nextIndex.fetch_add(chunkSize, std::memory_order_relaxed);
+		if (start >= count)
+		{
+			return;
+		}
+		auto end = std::min(start + chunkSize, count);
+		for (auto i = start; i < end; i++)
+		{
+			func(i);
+		}
+	}
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& func, size_t minChunkSize)
+{
+	minChunkSize = std::max(minChunkSize, (size_t)1);
+	if (workers.empty() == true || count <= minChunkSize)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			func(i);
+		}
+		return;
+	}
+
+	// several chunks per thread, so uneven work can be balanced
+	auto chunkSize = std::max(minChunkSize, count / ((workers.size() + 1) * 4));
+	{
+		std::lock_guard lock(mutex);
+		job = &func;
+		jobCount = count;
+		jobChunkSize = chunkSize;
+		nextIndex.store(0, std::memory_order_relaxed);
+		jobGeneration++;
+	}
+	workAvailable.notify_all();
+
+	runChunks(func, count, chunkSize);
+
+	std::unique_lock lock(mutex);
+	workDone.wait(lock, [&] { return activeWorkers == 0; });
+	job = nullptr;
+}
+
+ThreadPool& ThreadPool::getDefault()
+{
+	static ThreadPool pool;
+	return pool;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// fixed size pool of worker threads to run data parallel loops.
+// the calling thread also takes part in the work.
+class ThreadPool
+{
+private:
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable workAvailable;
+	std::condition_variable workDone;
+
+	const std::function<void(size_t)>* job{ nullptr };
+	size_t jobCount{ 0 };
+	size_t jobChunkSize{ 1 };
+	std::atomic<size_t> nextIndex{ 0 };
+	uint64_t jobGeneration{ 0 };
+	size_t activeWorkers{ 0 };
+	bool stopping{ false };
+
+	void workerLoop();
+	void runChunks(const std::function<void(size_t)>& func, size_t count, size_t chunkSize);
+
+public:
+	// numThreads is the number of worker threads (0 = number of cores - 1).
+	ThreadPool(size_t numThreads = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	size_t size() const noexcept { return workers.size(); }
+
+	// calls func(i) for i in [0, count) and returns when all calls have finished.
+	// indexes are claimed in chunks of at least minChunkSize, so idle threads
+	// keep taking work from busy ones. not reentrant.
+	void parallelFor(size_t count, const std::function<void(size_t)>& func, size_t minChunkSize = 16);
+
+	static ThreadPool& getDefault();
+};
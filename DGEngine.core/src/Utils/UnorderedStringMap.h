@@ -1,26 +1,521 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
+// 64 bit multiply/xor-shift hash, 8 bytes at a time (no per byte loop).
+inline uint64_t hashStringView(std::string_view str) noexcept
+{
+	constexpr uint64_t mul1 = 0x9E3779B97F4A7C15ull;
+	constexpr uint64_t mul2 = 0xBF58476D1CE4E5B9ull;
+
+	auto read = [](const char* data, size_t size) noexcept
+	{
+		uint64_t word = 0;
+		std::memcpy(&word, data, size);
+		return word;
+	};
+
+	auto data = str.data();
+	auto size = str.size();
+	uint64_t hash = size * mul1;
+	if (size >= 8)
+	{
+		// the last word overlaps the previous one, if needed
+		auto end = data + size - 8;
+		while (data < end)
+		{
+			hash = (hash ^ (read(data, 8) * mul2)) * mul1;
+			hash ^= hash >> 31;
+			data += 8;
+		}
+		hash = (hash ^ (read(end, 8) * mul2)) * mul1;
+	}
+	else if (size >= 4)
+	{
+		auto word = (read(data, 4) << 32) | read(data + size - 4, 4);
+		hash = (hash ^ (word * mul2)) * mul1;
+	}
+	else if (size > 0)
+	{
+		auto word = ((uint64_t)(uint8_t)data[0] << 16) |
+			((uint64_t)(uint8_t)data[size / 2] << 8) |
+			(uint64_t)(uint8_t)data[size - 1];
+		hash = (hash ^ (word * mul2)) * mul1;
+	}
+	hash ^= hash >> 30;
+	hash *= mul2;
+	hash ^= hash >> 27;
+	return hash;
+}
 
 struct StringViewHashEq
 {
 	using is_transparent = void;
-	using hash_type = std::hash<std::string_view>;
 	using transparent_key_equal = std::equal_to<>;
-	size_t operator()(std::string_view str) const { return hash_type{}(str); }
-	size_t operator()(const std::string& str) const { return hash_type{}(str); }
-	size_t operator()(const char* str) const { return hash_type{}(str); }
+	size_t operator()(std::string_view str) const { return (size_t)hashStringView(str); }
+	size_t operator()(const std::string& str) const { return (size_t)hashStringView(str); }
+	size_t operator()(const char* str) const { return (size_t)hashStringView(str); }
 
 	size_t operator()(std::string_view str1, std::string_view str2) const { return transparent_key_equal{}(str1, str2); }
 	size_t operator()(const std::string& str1, const std::string& str2) const { return transparent_key_equal{}(str1, str2); }
 	size_t operator()(const char* str1, const char* str2) const { return transparent_key_equal{}(str1, str2); }
 };
 
-// std::unordered_map<std::string, T> with std::string_view support
+// std::unordered_map<std::string, T> replacement with std::string_view support.
+// uses an open addressing table (linear probing, backward shift deletion) of
+// (hash, entry index) pairs that points into fixed size chunks of entries, so lookups
+// touch one contiguous array and references to elements stay valid until erased,
+// like with std::unordered_map. keys are std::string, which stores short ids inline.
 template <class T>
-using UnorderedStringMap = std::unordered_map<std::string, T, StringViewHashEq, StringViewHashEq>;
+class UnorderedStringMap
+{
+public:
+	using key_type = std::string;
+	using mapped_type = T;
+	using value_type = std::pair<const std::string, T>;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+
+private:
+	// entries are allocated in chunks that never move.
+	// erased entries are left empty and reused by later inserts.
+	class Entries
+	{
+	private:
+		static constexpr size_t ChunkBits = 5;
+		static constexpr size_t ChunkSize = (size_t)1 << ChunkBits;
+
+		std::vector<std::unique_ptr<std::optional<value_type>[]>> chunks;
+		size_t numEntries{ 0 };
+
+	public:
+		Entries() = default;
+
+		Entries(const Entries& other)
+		{
+			for (size_t i = 0; i < other.numEntries; i++)
+			{
+				emplace_back();
+				if (other[i].has_value() == true)
+				{
+					(*this)[i].emplace(*other[i]);
+				}
+			}
+		}
+
+		Entries& operator=(const Entries&) = delete;
+
+		auto& operator[](size_t idx) noexcept { return chunks[idx >> ChunkBits][idx & (ChunkSize - 1)]; }
+		auto& operator[](size_t idx) const noexcept { return chunks[idx >> ChunkBits][idx & (ChunkSize - 1)]; }
+
+		size_t size() const noexcept { return numEntries; }
+
+		void emplace_back()
+		{
+			if ((numEntries >> ChunkBits) >= chunks.size())
+			{
+				chunks.push_back(std::make_unique<std::optional<value_type>[]>(ChunkSize));
+			}
+			numEntries++;
+		}
+
+		// keeps the allocated chunks
+		void clear() noexcept
+		{
+			for (size_t i = 0; i < numEntries; i++)
+			{
+				(*this)[i].reset();
+			}
+			numEntries = 0;
+		}
+
+		void swap(Entries& other) noexcept
+		{
+			chunks.swap(other.chunks);
+			std::swap(numEntries, other.numEntries);
+		}
+	};
+
+	struct Bucket
+	{
+		uint32_t hash;
+		uint32_t idx;
+	};
+
+	static constexpr uint32_t EmptyBucket = UINT32_MAX;
+	static constexpr size_t MinBuckets = 8;
+
+	Entries entries;
+	std::vector<uint32_t> freeEntries;
+	std::vector<Bucket> buckets;
+	size_t numElements{ 0 };
+
+	static uint32_t getHash(std::string_view key) noexcept
+	{
+		auto hash = hashStringView(key);
+		return (uint32_t)(hash ^ (hash >> 32));
+	}
+
+	size_t mask() const noexcept { return buckets.size() - 1; }
+
+	// returns the bucket position holding key, or the empty bucket where it would go.
+	size_t findBucket(std::string_view key, uint32_t hash) const noexcept
+	{
+		auto pos = hash & mask();
+		while (true)
+		{
+			const auto& bucket = buckets[pos];
+			if (bucket.idx == EmptyBucket ||
+				(bucket.hash == hash && entries[bucket.idx]->first == key))
+			{
+				return pos;
+			}
+			pos = (pos + 1) & mask();
+		}
+	}
+
+	void rehash(size_t numBuckets)
+	{
+		std::vector<Bucket> oldBuckets(numBuckets, Bucket{ 0, EmptyBucket });
+		oldBuckets.swap(buckets);
+		for (const auto& bucket : oldBuckets)
+		{
+			if (bucket.idx == EmptyBucket)
+			{
+				continue;
+			}
+			auto pos = bucket.hash & mask();
+			while (buckets[pos].idx != EmptyBucket)
+			{
+				pos = (pos + 1) & mask();
+			}
+			buckets[pos] = bucket;
+		}
+	}
+
+	void reserveBuckets(size_t size)
+	{
+		// keep the load factor under 3/4
+		if (size * 4 <= buckets.size() * 3)
+		{
+			return;
+		}
+		auto numBuckets = std::max(buckets.size() * 2, MinBuckets);
+		while (size * 4 > numBuckets * 3)
+		{
+			numBuckets *= 2;
+		}
+		rehash(numBuckets);
+	}
+
+	void eraseBucket(size_t pos)
+	{
+		auto idx = buckets[pos].idx;
+
+		// move back the following entries of the cluster that can't be reached
+		// from their home bucket anymore (no tombstones)
+		auto next = pos;
+		while (true)
+		{
+			next = (next + 1) & mask();
+			const auto& bucket = buckets[next];
+			if (bucket.idx == EmptyBucket)
+			{
+				break;
+			}
+			auto home = bucket.hash & mask();
+			if (((next - home) & mask()) >= ((next - pos) & mask()))
+			{
+				buckets[pos] = bucket;
+				pos = next;
+			}
+		}
+		buckets[pos].idx = EmptyBucket;
+
+		entries[idx].reset();
+		numElements--;
+		if (numElements == 0)
+		{
+			entries.clear();
+			freeEntries.clear();
+		}
+		else
+		{
+			freeEntries.push_back(idx);
+		}
+	}
+
+	template <bool IsConst>
+	class Iterator
+	{
+	private:
+		using EntriesPtr = std::conditional_t<IsConst, const Entries*, Entries*>;
+
+		EntriesPtr entries{ nullptr };
+		size_t idx{ 0 };
+
+		void skipEmpty() noexcept
+		{
+			while (idx < entries->size() && (*entries)[idx].has_value() == false)
+			{
+				idx++;
+			}
+		}
+
+		friend class UnorderedStringMap;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = UnorderedStringMap::value_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+		using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+		Iterator() noexcept = default;
+		Iterator(EntriesPtr entries_, size_t idx_) noexcept : entries(entries_), idx(idx_) { skipEmpty(); }
+
+		template <bool OtherConst, class = std::enable_if_t<IsConst == true && OtherConst == false>>
+		Iterator(const Iterator<OtherConst>& other) noexcept : entries(other.entries), idx(other.idx) {}
+
+		reference operator*() const noexcept { return *(*entries)[idx]; }
+		pointer operator->() const noexcept { return &*(*entries)[idx]; }
+
+		Iterator& operator++() noexcept
+		{
+			idx++;
+			skipEmpty();
+			return *this;
+		}
+
+		Iterator operator++(int) noexcept
+		{
+			auto it = *this;
+			++(*this);
+			return it;
+		}
+
+		bool operator==(const Iterator& other) const noexcept { return idx == other.idx; }
+		bool operator!=(const Iterator& other) const noexcept { return idx != other.idx; }
+
+		template <bool>
+		friend class Iterator;
+	};
+
+public:
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+	UnorderedStringMap() = default;
+	UnorderedStringMap(const UnorderedStringMap&) = default;
+
+	UnorderedStringMap(UnorderedStringMap&& other) noexcept
+	{
+		swap(other);
+	}
+
+	UnorderedStringMap(std::initializer_list<value_type> init)
+	{
+		reserve(init.size());
+		for (const auto& value : init)
+		{
+			insert(value);
+		}
+	}
+
+	UnorderedStringMap& operator=(const UnorderedStringMap& other)
+	{
+		if (this != &other)
+		{
+			UnorderedStringMap copy(other);
+			swap(copy);
+		}
+		return *this;
+	}
+
+	UnorderedStringMap& operator=(UnorderedStringMap&& other) noexcept
+	{
+		if (this != &other)
+		{
+			clear();
+			swap(other);
+		}
+		return *this;
+	}
+
+	void swap(UnorderedStringMap& other) noexcept
+	{
+		entries.swap(other.entries);
+		freeEntries.swap(other.freeEntries);
+		buckets.swap(other.buckets);
+		std::swap(numElements, other.numElements);
+	}
+
+	iterator begin() noexcept { return iterator(&entries, 0); }
+	iterator end() noexcept { return iterator(&entries, entries.size()); }
+	const_iterator begin() const noexcept { return const_iterator(&entries, 0); }
+	const_iterator end() const noexcept { return const_iterator(&entries, entries.size()); }
+	const_iterator cbegin() const noexcept { return begin(); }
+	const_iterator cend() const noexcept { return end(); }
+
+	bool empty() const noexcept { return numElements == 0; }
+	size_t size() const noexcept { return numElements; }
+
+	void clear() noexcept
+	{
+		entries.clear();
+		freeEntries.clear();
+		for (auto& bucket : buckets)
+		{
+			bucket.idx = EmptyBucket;
+		}
+		numElements = 0;
+	}
+
+	void reserve(size_t size) { reserveBuckets(size); }
+
+	iterator find(std::string_view key) noexcept
+	{
+		if (numElements == 0)
+		{
+			return end();
+		}
+		auto idx = buckets[findBucket(key, getHash(key))].idx;
+		return idx != EmptyBucket ? iterator(&entries, idx) : end();
+	}
+
+	const_iterator find(std::string_view key) const noexcept
+	{
+		if (numElements == 0)
+		{
+			return end();
+		}
+		auto idx = buckets[findBucket(key, getHash(key))].idx;
+		return idx != EmptyBucket ? const_iterator(&entries, idx) : end();
+	}
+
+	bool contains(std::string_view key) const noexcept { return find(key) != end(); }
+	size_t count(std::string_view key) const noexcept { return contains(key) == true ? 1 : 0; }
+
+	T& at(std::string_view key)
+	{
+		auto it = find(key);
+		if (it == end())
+		{
+			throw std::out_of_range("UnorderedStringMap::at");
+		}
+		return it->second;
+	}
+
+	const T& at(std::string_view key) const
+	{
+		auto it = find(key);
+		if (it == end())
+		{
+			throw std::out_of_range("UnorderedStringMap::at");
+		}
+		return it->second;
+	}
+
+	template <class K, class... Args>
+	std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+	{
+		std::string_view keyView(key);
+		auto hash = getHash(keyView);
+		reserveBuckets(numElements + 1);
+		auto pos = findBucket(keyView, hash);
+		if (buckets[pos].idx != EmptyBucket)
+		{
+			return { iterator(&entries, buckets[pos].idx), false };
+		}
+
+		uint32_t idx;
+		if (freeEntries.empty() == false)
+		{
+			idx = freeEntries.back();
+			freeEntries.pop_back();
+		}
+		else
+		{
+			idx = (uint32_t)entries.size();
+			entries.emplace_back();
+		}
+		entries[idx].emplace(std::piecewise_construct,
+			std::forward_as_tuple(std::string(std::forward<K>(key))),
+			std::forward_as_tuple(std::forward<Args>(args)...));
+		buckets[pos] = Bucket{ hash, idx };
+		numElements++;
+		return { iterator(&entries, idx), true };
+	}
+
+	template <class K, class V>
+	std::pair<iterator, bool> emplace(K&& key, V&& value)
+	{
+		return try_emplace(std::forward<K>(key), std::forward<V>(value));
+	}
+
+	template <class P>
+	std::pair<iterator, bool> insert(P&& value)
+	{
+		return try_emplace(std::forward<P>(value).first, std::forward<P>(value).second);
+	}
+
+	template <class K, class V>
+	std::pair<iterator, bool> insert_or_assign(K&& key, V&& value)
+	{
+		auto ret = try_emplace(std::forward<K>(key), std::forward<V>(value));
+		if (ret.second == false)
+		{
+			ret.first->second = std::forward<V>(value);
+		}
+		return ret;
+	}
+
+	T& operator[](std::string_view key)
+	{
+		return try_emplace(key).first->second;
+	}
+
+	size_t erase(std::string_view key)
+	{
+		if (numElements == 0)
+		{
+			return 0;
+		}
+		auto pos = findBucket(key, getHash(key));
+		if (buckets[pos].idx == EmptyBucket)
+		{
+			return 0;
+		}
+		eraseBucket(pos);
+		return 1;
+	}
+
+	iterator erase(const_iterator it)
+	{
+		auto idx = it.idx;
+		erase(std::string_view((*it).first));
+		if (numElements == 0)
+		{
+			return end();
+		}
+		return iterator(&entries, idx + 1);
+	}
+
+	iterator erase(iterator it) { return erase(const_iterator(it)); }
+};
 
 // std::unordered_multimap<std::string, T> with std::string_view support
 template <class T>
@@ -0,0 +1,383 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include "Json/SaveUtils.h"
+
+namespace Benchmark
+{
+	using namespace rapidjson;
+	using namespace SaveUtils;
+
+	void useCharPointer(const volatile char* ptr) noexcept
+	{
+		static const volatile char* sink;
+		sink = ptr;
+	}
+
+	namespace
+	{
+		using Clock = std::chrono::steady_clock;
+
+		std::chrono::nanoseconds measure(const Function& function, uint64_t numIterations)
+		{
+			auto start = Clock::now();
+			function(numIterations);
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+		}
+
+		double median(std::vector<double> values)
+		{
+			if (values.empty() == true)
+			{
+				return 0.0;
+			}
+			std::sort(values.begin(), values.end());
+			auto mid = values.size() / 2;
+			if ((values.size() % 2) == 0)
+			{
+				return (values[mid - 1] + values[mid]) / 2.0;
+			}
+			return values[mid];
+		}
+
+		void writeCsvString(std::ostream& out, const std::string_view str)
+		{
+			out << '"';
+			for (auto ch : str)
+			{
+				if (ch == '"')
+				{
+					out << '"';
+				}
+				out << ch;
+			}
+			out << '"';
+		}
+	}
+
+	bool Runner::isSelected(const std::string_view name) const
+	{
+		return filter.empty() == true || name.find(filter) != std::string_view::npos;
+	}
+
+	void Runner::add(const std::string_view name, Function function, std::vector<Counter> counters)
+	{
+		benchmarks.push_back({ std::string(name), std::move(function), {}, std::move(counters) });
+	}
+
+	void Runner::skip(const std::string_view name, const std::string_view reason)
+	{
+		benchmarks.push_back({ std::string(name), {}, std::string(reason) });
+	}
+
+	void Runner::addCheck(const std::string_view name, CheckFunction function)
+	{
+		checks.push_back({ std::string(name), std::move(function), {} });
+	}
+
+	void Runner::skipCheck(const std::string_view name, const std::string_view reason)
+	{
+		checks.push_back({ std::string(name), {}, std::string(reason) });
+	}
+
+	Result Runner::run(const Entry& entry) const
+	{
+		Result result;
+		result.name = entry.name;
+		if (entry.function == nullptr)
+		{
+			result.skipReason = entry.skipReason;
+			return result;
+		}
+
+		// calibrate the number of iterations per sample. the last calibration run
+		// also warms up the caches and isn't used in the results.
+		uint64_t numIterations = 1;
+		while (true)
+		{
+			auto elapsed = measure(entry.function, numIterations);
+			if (elapsed >= minSampleTime ||
+				numIterations >= (uint64_t)1 << 40)
+			{
+				break;
+			}
+			auto scale = 2.0;
+			if (elapsed.count() > 0)
+			{
+				scale = std::clamp(1.2 * (double)minSampleTime.count() / (double)elapsed.count(), 1.5, 100.0);
+			}
+			numIterations = (uint64_t)std::ceil((double)numIterations * scale);
+		}
+
+		std::vector<uint64_t> counterTotals;
+		for (const auto& counter : entry.counters)
+		{
+			counterTotals.push_back(counter.total());
+		}
+
+		std::vector<double> samples;
+		samples.reserve(numSamples);
+		std::chrono::nanoseconds totalElapsed{ 0 };
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			auto elapsed = measure(entry.function, numIterations);
+			totalElapsed += elapsed;
+			samples.push_back((double)elapsed.count() / (double)numIterations);
+		}
+
+		for (size_t i = 0; i < entry.counters.size(); i++)
+		{
+			auto count = (double)(entry.counters[i].total() - counterTotals[i]);
+			CounterResult counter;
+			counter.name = entry.counters[i].name;
+			if (samples.empty() == false)
+			{
+				counter.perIteration = count / ((double)numIterations * (double)samples.size());
+			}
+			if (totalElapsed.count() > 0)
+			{
+				counter.perSecond = count * 1e9 / (double)totalElapsed.count();
+			}
+			result.counters.push_back(std::move(counter));
+		}
+
+		result.iterations = numIterations;
+		result.samples = (uint32_t)samples.size();
+		if (samples.empty() == true)
+		{
+			return result;
+		}
+		result.min = *std::min_element(samples.begin(), samples.end());
+		result.median = median(samples);
+
+		double sum = 0.0;
+		for (auto sample : samples)
+		{
+			sum += sample;
+		}
+		result.mean = sum / (double)samples.size();
+
+		double sumSquares = 0.0;
+		std::vector<double> deviations;
+		deviations.reserve(samples.size());
+		for (auto sample : samples)
+		{
+			sumSquares += (sample - result.mean) * (sample - result.mean);
+			deviations.push_back(std::abs(sample - result.median));
+		}
+		if (samples.size() > 1)
+		{
+			result.stdDev = std::sqrt(sumSquares / (double)(samples.size() - 1));
+		}
+		result.mad = median(std::move(deviations));
+		return result;
+	}
+
+	std::vector<Result> Runner::run() const
+	{
+		std::vector<Result> results;
+		for (const auto& entry : benchmarks)
+		{
+			if (isSelected(entry.name) == true)
+			{
+				results.push_back(run(entry));
+			}
+		}
+		return results;
+	}
+
+	std::vector<CheckResult> Runner::runChecks() const
+	{
+		std::vector<CheckResult> results;
+		for (const auto& entry : checks)
+		{
+			if (isSelected(entry.name) == false)
+			{
+				continue;
+			}
+			CheckResult result;
+			result.name = entry.name;
+			if (entry.function == nullptr)
+			{
+				result.skipReason = entry.skipReason;
+			}
+			else
+			{
+				try
+				{
+					result.error = entry.function();
+				}
+				catch (std::exception& ex)
+				{
+					result.error = ex.what();
+				}
+			}
+			results.push_back(std::move(result));
+		}
+		return results;
+	}
+
+	void Runner::list(std::ostream& out) const
+	{
+		for (const auto& entry : checks)
+		{
+			if (isSelected(entry.name) == true)
+			{
+				out << entry.name << " (check)\n";
+			}
+		}
+		for (const auto& entry : benchmarks)
+		{
+			if (isSelected(entry.name) == true)
+			{
+				out << entry.name << '\n';
+			}
+		}
+	}
+
+	void write(std::ostream& out, const std::vector<Result>& results, OutputFormat format)
+	{
+		switch (format)
+		{
+		default:
+		case OutputFormat::Text:
+		{
+			char buffer[256];
+			std::snprintf(buffer, sizeof(buffer), "%-32s %12s %12s %12s %12s %8s\n",
+				"benchmark", "iterations", "median ns", "min ns", "mean ns", "mad %");
+			out << buffer;
+			for (const auto& result : results)
+			{
+				if (result.skipReason.empty() == false)
+				{
+					std::snprintf(buffer, sizeof(buffer), "%-32s skipped: ", result.name.c_str());
+					out << buffer << result.skipReason << '\n';
+					continue;
+				}
+				std::snprintf(buffer, sizeof(buffer), "%-32s %12llu %12.1f %12.1f %12.1f %8.2f\n",
+					result.name.c_str(),
+					(unsigned long long)result.iterations,
+					result.median,
+					result.min,
+					result.mean,
+					(result.median > 0.0 ? 100.0 * result.mad / result.median : 0.0));
+				out << buffer;
+				for (const auto& counter : result.counters)
+				{
+					std::snprintf(buffer, sizeof(buffer), "  %-30s %12.1f/s %12.3f/iteration\n",
+						counter.name.c_str(), counter.perSecond, counter.perIteration);
+					out << buffer;
+				}
+			}
+			break;
+		}
+		case OutputFormat::Json:
+		{
+			StringBuffer buffer;
+			PrettyWriter<StringBuffer> writer(buffer);
+			writer.SetIndent(' ', 2);
+
+			writer.StartObject();
+			writeKeyStringView(writer, "benchmarks");
+			writer.StartArray();
+			for (const auto& result : results)
+			{
+				writer.StartObject();
+				writeString(writer, "name", result.name);
+				if (result.skipReason.empty() == false)
+				{
+					writeString(writer, "skipped", result.skipReason);
+				}
+				else
+				{
+					writeUInt64(writer, "iterations", result.iterations);
+					writeUInt(writer, "samples", result.samples);
+					writeDouble(writer, "median", result.median);
+					writeDouble(writer, "min", result.min);
+					writeDouble(writer, "mean", result.mean);
+					writeDouble(writer, "stdDev", result.stdDev);
+					writeDouble(writer, "mad", result.mad);
+					if (result.counters.empty() == false)
+					{
+						writeKeyStringView(writer, "counters");
+						writer.StartArray();
+						for (const auto& counter : result.counters)
+						{
+							writer.StartObject();
+							writeString(writer, "name", counter.name);
+							writeDouble(writer, "perIteration", counter.perIteration);
+							writeDouble(writer, "perSecond", counter.perSecond);
+							writer.EndObject();
+						}
+						writer.EndArray();
+					}
+				}
+				writer.EndObject();
+			}
+			writer.EndArray();
+			writeStringView(writer, "unit", "ns");
+			writer.EndObject();
+
+			out << std::string_view(buffer.GetString(), buffer.GetSize()) << '\n';
+			break;
+		}
+		case OutputFormat::Csv:
+		{
+			// counters are in one column as name=perSecond pairs separated by ';'
+			out << "name,iterations,samples,median,min,mean,stdDev,mad,skipped,counters\n";
+			for (const auto& result : results)
+			{
+				writeCsvString(out, result.name);
+				out << ',' << result.iterations <<
+					',' << result.samples <<
+					',' << result.median <<
+					',' << result.min <<
+					',' << result.mean <<
+					',' << result.stdDev <<
+					',' << result.mad << ',';
+				writeCsvString(out, result.skipReason);
+				std::string counters;
+				for (const auto& counter : result.counters)
+				{
+					if (counters.empty() == false)
+					{
+						counters += ';';
+					}
+					counters += counter.name + '=' + std::to_string(counter.perSecond);
+				}
+				out << ',';
+				writeCsvString(out, counters);
+				out << '\n';
+			}
+			break;
+		}
+		}
+	}
+
+	bool write(std::ostream& out, const std::vector<CheckResult>& results)
+	{
+		bool passed = true;
+		char buffer[256];
+		for (const auto& result : results)
+		{
+			std::snprintf(buffer, sizeof(buffer), "check %-32s ", result.name.c_str());
+			out << buffer;
+			if (result.skipReason.empty() == false)
+			{
+				out << "skipped: " << result.skipReason << '\n';
+			}
+			else if (result.error.empty() == false)
+			{
+				out << "FAILED: " << result.error << '\n';
+				passed = false;
+			}
+			else
+			{
+				out << "ok\n";
+			}
+		}
+		return passed;
+	}
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Benchmark
+{
+	void useCharPointer(const volatile char* ptr) noexcept;
+
+	// keeps the compiler from optimizing away a value computed inside a benchmark.
+	template <class T>
+	void doNotOptimize(const T& value) noexcept
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "m"(value) : "memory");
+#else
+		useCharPointer(&reinterpret_cast<const volatile char&>(value));
+#endif
+	}
+
+	// runs the measured operation the given number of times.
+	using Function = std::function<void(uint64_t numIterations)>;
+
+	// a running total kept by a benchmark (ex: path searches), reported per second.
+	struct Counter
+	{
+		std::string name;
+		// returns the current total. read before and after the samples.
+		std::function<uint64_t()> total;
+	};
+
+	struct CounterResult
+	{
+		std::string name;
+		double perIteration{ 0.0 };
+		double perSecond{ 0.0 };
+	};
+
+	// verifies a result. returns an empty string if it passed or the reason it failed.
+	using CheckFunction = std::function<std::string()>;
+
+	struct Result
+	{
+		std::string name;
+		// not empty if the benchmark wasn't run (missing input file, etc).
+		std::string skipReason;
+		// iterations per sample
+		uint64_t iterations{ 0 };
+		uint32_t samples{ 0 };
+		// nanoseconds per iteration
+		double min{ 0.0 };
+		double median{ 0.0 };
+		double mean{ 0.0 };
+		double stdDev{ 0.0 };
+		// median absolute deviation
+		double mad{ 0.0 };
+		std::vector<CounterResult> counters;
+	};
+
+	struct CheckResult
+	{
+		std::string name;
+		// not empty if the check failed.
+		std::string error;
+		// not empty if the check wasn't run.
+		std::string skipReason;
+	};
+
+	enum class OutputFormat
+	{
+		Text,
+		Json,
+		Csv
+	};
+
+	class Runner
+	{
+	private:
+		struct Entry
+		{
+			std::string name;
+			Function function;
+			std::string skipReason;
+			std::vector<Counter> counters;
+		};
+
+		struct CheckEntry
+		{
+			std::string name;
+			CheckFunction function;
+			std::string skipReason;
+		};
+
+		std::vector<Entry> benchmarks;
+		std::vector<CheckEntry> checks;
+
+		bool isSelected(const std::string_view name) const;
+
+		Result run(const Entry& entry) const;
+
+	public:
+		// only benchmarks whose name contains the filter are run.
+		std::string filter;
+		uint32_t numSamples{ 15 };
+		// each sample runs enough iterations to take at least this long.
+		std::chrono::nanoseconds minSampleTime{ std::chrono::milliseconds(10) };
+
+		void add(const std::string_view name, Function function, std::vector<Counter> counters = {});
+
+		// adds a benchmark that is reported as skipped.
+		void skip(const std::string_view name, const std::string_view reason);
+
+		// adds a correctness check. checks run before the benchmarks and fail the run.
+		void addCheck(const std::string_view name, CheckFunction function);
+
+		// adds a check that is reported as skipped.
+		void skipCheck(const std::string_view name, const std::string_view reason);
+
+		std::vector<Result> run() const;
+
+		std::vector<CheckResult> runChecks() const;
+
+		void list(std::ostream& out) const;
+	};
+
+	void write(std::ostream& out, const std::vector<Result>& results, OutputFormat format);
+
+	// writes one line per check. returns false if any check failed.
+	bool write(std::ostream& out, const std::vector<CheckResult>& results);
+}
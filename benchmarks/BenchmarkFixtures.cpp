@@ -0,0 +1,308 @@
+#include "BenchmarkFixtures.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include "Json/JsonUtils.h"
+#include <unordered_set>
+
+#ifndef DGENGINE_BENCHMARK_DATA_DIR
+#define DGENGINE_BENCHMARK_DATA_DIR "."
+#endif
+
+namespace Benchmark::Fixtures
+{
+	namespace
+	{
+		void write16(FileBytes& bytes, uint16_t val)
+		{
+			bytes.push_back((uint8_t)(val & 0xFF));
+			bytes.push_back((uint8_t)(val >> 8));
+		}
+
+		void write32(FileBytes& bytes, uint32_t val)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				bytes.push_back((uint8_t)(val >> (i * 8)));
+			}
+		}
+
+		void set16(FileBytes& bytes, size_t pos, uint16_t val)
+		{
+			bytes[pos] = (uint8_t)(val & 0xFF);
+			bytes[pos + 1] = (uint8_t)(val >> 8);
+		}
+
+		void set32(FileBytes& bytes, size_t pos, uint32_t val)
+		{
+			for (size_t i = 0; i < 4; i++)
+			{
+				bytes[pos + i] = (uint8_t)(val >> (i * 8));
+			}
+		}
+
+		// palette indexes of a line. changes per line and frame so runs aren't all the same.
+		uint8_t getPixel(uint32_t frame, uint32_t x, uint32_t y) noexcept
+		{
+			return (uint8_t)(1 + ((x * 7 + y * 13 + frame * 31) % 254));
+		}
+
+		// a line is one quarter transparent pixels followed by opaque pixels.
+		// CEL: 0x80-0xFF = (256 - n) transparent pixels, 0x01-0x7F = n palette indexes.
+		void writeCELLine(FileBytes& bytes, uint32_t frame, uint32_t y, uint32_t width)
+		{
+			auto numTransparent = width / 4;
+			bytes.push_back((uint8_t)(256 - numTransparent));
+			auto x = numTransparent;
+			while (x < width)
+			{
+				auto numPixels = std::min(width - x, 0x7Fu);
+				bytes.push_back((uint8_t)numPixels);
+				for (uint32_t i = 0; i < numPixels; i++)
+				{
+					bytes.push_back(getPixel(frame, x + i, y));
+				}
+				x += numPixels;
+			}
+		}
+
+		// a line is one quarter transparent pixels, a repeated palette index
+		// and palette indexes.
+		// CL2: 0x01-0x7F = n transparent pixels, 0x80-0xBE = (0xBF - n) repeated index,
+		// 0xBF-0xFF = (256 - n) palette indexes.
+		void writeCL2Line(FileBytes& bytes, uint32_t frame, uint32_t y, uint32_t width)
+		{
+			auto numTransparent = width / 4;
+			bytes.push_back((uint8_t)numTransparent);
+			auto x = numTransparent;
+			auto numRepeated = std::min((width - x) / 3, 0x3Fu);
+			if (numRepeated > 0)
+			{
+				bytes.push_back((uint8_t)(0xBF - numRepeated));
+				bytes.push_back(getPixel(frame, x, y));
+				x += numRepeated;
+			}
+			while (x < width)
+			{
+				auto numPixels = std::min(width - x, 0x41u);
+				bytes.push_back((uint8_t)(256 - numPixels));
+				for (uint32_t i = 0; i < numPixels; i++)
+				{
+					bytes.push_back(getPixel(frame, x + i, y));
+				}
+				x += numPixels;
+			}
+		}
+
+		// DC6: 0x80 = end of line, 0x81-0xFF = (n & 0x7F) transparent pixels,
+		// 0x00-0x7F = n palette indexes.
+		void writeDC6Line(FileBytes& bytes, uint32_t frame, uint32_t y, uint32_t width)
+		{
+			auto numTransparent = width / 4;
+			bytes.push_back((uint8_t)(0x80 | numTransparent));
+			auto x = numTransparent;
+			while (x < width)
+			{
+				auto numPixels = std::min(width - x, 0x7Fu);
+				bytes.push_back((uint8_t)numPixels);
+				for (uint32_t i = 0; i < numPixels; i++)
+				{
+					bytes.push_back(getPixel(frame, x + i, y));
+				}
+				x += numPixels;
+			}
+			bytes.push_back(0x80);
+		}
+
+		// CEL and CL2 files with a single group have the same layout:
+		// number of frames, frame offsets, file size, frames.
+		// each frame starts with a header with the offsets of every 32 lines.
+		template <class WriteLine>
+		std::shared_ptr<FileBytes> makeCELFile(uint32_t numFrames, uint32_t width,
+			uint32_t height, WriteLine writeLine)
+		{
+			auto bytes = std::make_shared<FileBytes>();
+			write32(*bytes, numFrames);
+			for (uint32_t i = 0; i <= numFrames; i++)
+			{
+				write32(*bytes, 0);
+			}
+			for (uint32_t i = 0; i < numFrames; i++)
+			{
+				auto frameStart = bytes->size();
+				set32(*bytes, 4 + i * 4, (uint32_t)frameStart);
+
+				write16(*bytes, 0x0A);
+				for (int j = 0; j < 4; j++)
+				{
+					write16(*bytes, 0);
+				}
+				for (uint32_t y = 0; y < height; y++)
+				{
+					writeLine(*bytes, i, y, width);
+					if (((y + 1) % 32) == 0 && y < 128)
+					{
+						set16(*bytes, frameStart + 2 + (y / 32) * 2,
+							(uint16_t)(bytes->size() - frameStart));
+					}
+				}
+			}
+			set32(*bytes, 4 + numFrames * 4, (uint32_t)bytes->size());
+			return bytes;
+		}
+	}
+
+	PaletteArray makePalette()
+	{
+		PaletteArray palette;
+		for (size_t i = 0; i < palette.size(); i++)
+		{
+			palette[i] = sf::Color((uint8_t)i, (uint8_t)i, (uint8_t)i);
+		}
+		return palette;
+	}
+
+	std::shared_ptr<FileBytes> makeCEL(uint32_t numFrames, uint32_t width, uint32_t height)
+	{
+		return makeCELFile(numFrames, width, height, writeCELLine);
+	}
+
+	std::shared_ptr<FileBytes> makeCL2(uint32_t numFrames, uint32_t width, uint32_t height)
+	{
+		return makeCELFile(numFrames, width, height, writeCL2Line);
+	}
+
+	std::shared_ptr<FileBytes> makeDC6(uint32_t directions, uint32_t framesPerDir,
+		uint32_t width, uint32_t height)
+	{
+		auto bytes = std::make_shared<FileBytes>();
+		auto numFrames = directions * framesPerDir;
+
+		write32(*bytes, 6);				// version
+		write32(*bytes, 1);				// flags
+		write32(*bytes, 0);				// format
+		write32(*bytes, 0xEEEEEEEE);	// marker
+		write32(*bytes, directions);
+		write32(*bytes, framesPerDir);
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			write32(*bytes, 0);
+		}
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			auto frameStart = bytes->size();
+			set32(*bytes, 0x18 + i * 4, (uint32_t)frameStart);
+
+			write32(*bytes, 0);			// flip (scanlines from bottom to top)
+			write32(*bytes, width);
+			write32(*bytes, height);
+			write32(*bytes, 0);			// offsetX
+			write32(*bytes, 0);			// offsetY
+			write32(*bytes, 0);			// allocSize
+			write32(*bytes, 0);			// nextBlock
+			write32(*bytes, 0);			// length
+
+			auto dataStart = bytes->size();
+			for (uint32_t y = 0; y < height; y++)
+			{
+				writeDC6Line(*bytes, i, y, width);
+			}
+			set32(*bytes, frameStart + 28, (uint32_t)(bytes->size() - dataStart));
+
+			// terminator
+			bytes->insert(bytes->end(), 3, 0xEE);
+			set32(*bytes, frameStart + 24, (uint32_t)bytes->size());
+		}
+		return bytes;
+	}
+
+	std::string getDataPath(const std::string_view filePath)
+	{
+		std::string path(DGENGINE_BENCHMARK_DATA_DIR);
+		if (path.empty() == false && path.back() != '/')
+		{
+			path += '/';
+		}
+		path += filePath;
+		return path;
+	}
+
+	std::string readFile(const std::string_view filePath)
+	{
+		std::ifstream file(std::string(filePath), std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+
+	std::shared_ptr<FileBytes> readFileBytes(const std::string_view filePath)
+	{
+		std::ifstream file(std::string(filePath), std::ios::binary);
+		return std::make_shared<FileBytes>(
+			std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+
+	std::vector<std::string> getJsonIds(const std::string_view dirPath)
+	{
+		using namespace rapidjson;
+		using namespace std::literals;
+
+		std::vector<std::string> ids;
+		std::unordered_set<std::string> uniqueIds;
+
+		std::vector<std::filesystem::path> files;
+		std::error_code ec;
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(
+			std::filesystem::path(dirPath), ec))
+		{
+			if (entry.is_regular_file() == true &&
+				entry.path().extension() == ".json")
+			{
+				files.push_back(entry.path());
+			}
+		}
+		std::sort(files.begin(), files.end());
+
+		auto addIds = [&](const auto& self, const Value& elem) -> void
+		{
+			if (elem.IsObject() == true)
+			{
+				for (const auto& member : elem.GetObject())
+				{
+					if (member.name == "id"sv && member.value.IsString() == true)
+					{
+						if (member.value.GetStringLength() == 0)
+						{
+							continue;
+						}
+						std::string id(member.value.GetString(), member.value.GetStringLength());
+						if (uniqueIds.insert(id).second == true)
+						{
+							ids.push_back(std::move(id));
+						}
+					}
+					else
+					{
+						self(self, member.value);
+					}
+				}
+			}
+			else if (elem.IsArray() == true)
+			{
+				for (const auto& val : elem)
+				{
+					self(self, val);
+				}
+			}
+		};
+
+		for (const auto& file : files)
+		{
+			Document doc;
+			if (JsonUtils::loadJson(readFile(file.string()), doc) == true)
+			{
+				addIds(addIds, doc);
+			}
+		}
+		return ids;
+	}
+}
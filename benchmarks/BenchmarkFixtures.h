@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include "Resources/FileBytes.h"
+#include "Resources/Palette.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+// synthetic inputs for the benchmarks, so they can run without game assets.
+namespace Benchmark::Fixtures
+{
+	// grayscale palette.
+	PaletteArray makePalette();
+
+	// single group CEL file with frames of width x height pixels.
+	// every frame has a frame header (the width is computed from it).
+	// width must be in [4, 256] and height a multiple of 32.
+	std::shared_ptr<FileBytes> makeCEL(uint32_t numFrames, uint32_t width, uint32_t height);
+
+	// single group CL2 file with frames of width x height pixels.
+	// width must be in [4, 256] and height a multiple of 32.
+	std::shared_ptr<FileBytes> makeCL2(uint32_t numFrames, uint32_t width, uint32_t height);
+
+	// DC6 file with frames of width x height pixels.
+	// width must be in [4, 256].
+	std::shared_ptr<FileBytes> makeDC6(uint32_t directions, uint32_t framesPerDir,
+		uint32_t width, uint32_t height);
+
+	// path of a file bundled with the engine (gamefiles folders, etc).
+	std::string getDataPath(const std::string_view filePath);
+
+	// reads a whole file from disk (not from the PhysFS search path).
+	std::string readFile(const std::string_view filePath);
+
+	// reads a whole file from disk (not from the PhysFS search path).
+	std::shared_ptr<FileBytes> readFileBytes(const std::string_view filePath);
+
+	// unique values of the "id" keys of every json file in a folder on disk (recursive),
+	// in the order they're first found. files are sorted by path.
+	std::vector<std::string> getJsonIds(const std::string_view dirPath);
+}
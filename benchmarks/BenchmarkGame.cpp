@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <array>
+#include "Benchmarks.h"
+#include <cmath>
+#include "Game/Classifier.h"
+#include "Game/Formula.h"
+#include "Game/Inventory/Inventory.h"
+#include "Game/Item/Item.h"
+#include "Game/Item/ItemClass.h"
+#include "Game/Player/PlayerCombat.h"
+#include <memory>
+#include "Utils/Random.h"
+#include "Utils/StringHash.h"
+
+namespace Benchmark
+{
+	namespace
+	{
+		class PlayerQuery : public Queryable
+		{
+		public:
+			bool getProperty(const std::string_view prop, Variable& var) const override
+			{
+				switch (str2int16(prop))
+				{
+				case str2int16("level"):
+					var = Variable((int64_t)37);
+					return true;
+				case str2int16("strength"):
+					var = Variable((int64_t)60);
+					return true;
+				case str2int16("dexterity"):
+					var = Variable((int64_t)45);
+					return true;
+				case str2int16("vitality"):
+					var = Variable((int64_t)80);
+					return true;
+				case str2int16("class"):
+					var = Variable(std::string("Warrior"));
+					return true;
+				default:
+					return false;
+				}
+			}
+		};
+
+		// 10x4 inventory that is half full of 1x1 items and a 2x3 item to place.
+		struct InventoryFixture
+		{
+			ItemClass smallClass{ nullptr, nullptr, 0 };
+			ItemClass bigClass{ nullptr, nullptr, 0 };
+			Inventory inventory{ PairUInt8(10, 4) };
+			std::unique_ptr<Item> item;
+
+			InventoryFixture()
+			{
+				smallClass.InventorySize({ 1, 1 });
+				bigClass.InventorySize({ 2, 3 });
+				inventory.EnforceItemSize(true);
+				for (uint8_t y = 0; y < 4; y++)
+				{
+					for (uint8_t x = 0; x < 10; x += 2)
+					{
+						if (((x / 2) + y) % 2 == 0)
+						{
+							auto smallItem = std::make_shared<Item>(&smallClass);
+							inventory.set(PairUInt8(x, y), smallItem);
+						}
+					}
+				}
+				item = std::make_unique<Item>(&bigClass);
+			}
+		};
+
+		constexpr std::string_view DamageFormula = "((strength * level) / 100 + dexterity :max 50) * 1.5 :min 200";
+	}
+
+	void registerGameBenchmarks(Runner& runner)
+	{
+		auto formula = std::make_shared<Formula>(DamageFormula);
+		runner.add("formula.eval", [formula](uint64_t numIterations)
+			{
+				PlayerQuery query;
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					doNotOptimize(formula->eval(query));
+				}
+			});
+
+		runner.add("formula.evalString", [](uint64_t numIterations)
+			{
+				PlayerQuery query;
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					doNotOptimize(Formula::evalString(DamageFormula, query));
+				}
+			});
+
+		std::vector<ClassifierValueInterval> intervals;
+
+		// string match on the class
+		ClassifierValueInterval classInterval;
+		classInterval.property = "class";
+		for (auto name : { "Rogue", "Sorcerer", "Monk", "Bard", "Barbarian" })
+		{
+			classInterval.values.push_back({ std::string(name), Variable(std::string(name)) });
+		}
+		intervals.push_back(std::move(classInterval));
+
+		// level ranges
+		ClassifierValueInterval levelInterval;
+		levelInterval.property = "level";
+		for (LevelObjValue i = 0; i < 50; i += 5)
+		{
+			levelInterval.values.push_back({
+				ClassifierValue::ValuePair(i, i + 4),
+				Variable((int64_t)i)
+			});
+		}
+		intervals.push_back(std::move(levelInterval));
+
+		auto classifier = std::make_shared<Classifier>(std::move(intervals));
+		runner.add("classifier.get", [classifier](uint64_t numIterations)
+			{
+				PlayerQuery query;
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					doNotOptimize(classifier->get(query));
+				}
+			});
+
+		auto inventory = std::make_shared<InventoryFixture>();
+		for (auto invPos : { InventoryPosition::TopLeft, InventoryPosition::BottomRight })
+		{
+			std::string name("inventory.getFreeSlot");
+			if (invPos == InventoryPosition::BottomRight)
+			{
+				name += ".bottomRight";
+			}
+			runner.add(name, [inventory, invPos](uint64_t numIterations)
+				{
+					for (uint64_t i = 0; i < numIterations; i++)
+					{
+						size_t itemIdx = 0;
+						doNotOptimize(inventory->inventory.getFreeSlot(*inventory->item, itemIdx, invPos));
+						doNotOptimize(itemIdx);
+					}
+				});
+		}
+
+		runner.add("combat.resolveAttack", [](uint64_t numIterations)
+			{
+				PlayerCombat::Stats attacker;
+				attacker.toHit = 70;
+				attacker.damageMin = 4;
+				attacker.damageMax = 12;
+				PlayerCombat::Stats defender;
+				defender.armor = 25;
+				defender.resistFire = 40;
+				PCG32 rng(1);
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					doNotOptimize(PlayerCombat::resolveAttack(attacker, defender, DamageType::Fire, 4.f, rng));
+				}
+			});
+
+		// 41% to hit (70 - 25 armor - 4 cells) and 4-12 damage, 40% resisted.
+		runner.addCheck("combat.resolveAttack.rates", []() -> std::string
+			{
+				PlayerCombat::Stats attacker;
+				attacker.toHit = 70;
+				attacker.damageMin = 4;
+				attacker.damageMax = 12;
+				PlayerCombat::Stats defender;
+				defender.armor = 25;
+				defender.resistFire = 40;
+
+				constexpr int numAttacks = 100000;
+				// damage after resistances of each rolled damage (4-12)
+				constexpr std::array<LevelObjValue, 9> resistedDamage{ 3, 3, 4, 5, 5, 6, 6, 7, 8 };
+
+				auto combatState = Random::getState(RandomStream::Combat);
+				PCG32 rng(1234);
+				int numHits = 0;
+				std::array<int, 9> damageCounts{};
+				for (int i = 0; i < numAttacks; i++)
+				{
+					auto result = PlayerCombat::resolveAttack(attacker, defender, DamageType::Fire, 4.f, rng);
+					if (result.hit == false)
+					{
+						if (result.damage != 0)
+						{
+							return "a miss did " + std::to_string(result.damage) + " damage";
+						}
+						continue;
+					}
+					numHits++;
+					if (result.damage < 3 || result.damage > 8)
+					{
+						return "damage " + std::to_string(result.damage) + " out of [3, 8]";
+					}
+					damageCounts[result.damage - 3]++;
+				}
+				if (Random::getState(RandomStream::Combat) != combatState)
+				{
+					return "the combat random stream was used";
+				}
+
+				auto hitRate = (double)numHits / numAttacks;
+				if (std::abs(hitRate - 0.41) > 0.01)
+				{
+					return "hit rate " + std::to_string(hitRate) + ", expected 0.41";
+				}
+				for (LevelObjValue damage = 3; damage <= 8; damage++)
+				{
+					auto expected = (double)std::count(resistedDamage.begin(), resistedDamage.end(), damage) / 9.0;
+					auto rate = (double)damageCounts[damage - 3] / numHits;
+					if (std::abs(rate - expected) > 0.01)
+					{
+						return "damage " + std::to_string(damage) + " rate " + std::to_string(rate) +
+							", expected " + std::to_string(expected);
+					}
+				}
+
+				// same seed, same rolls
+				PCG32 rng1(99);
+				PCG32 rng2(99);
+				for (int i = 0; i < 1000; i++)
+				{
+					auto result1 = PlayerCombat::resolveAttack(attacker, defender, DamageType::Fire, 4.f, rng1);
+					auto result2 = PlayerCombat::resolveAttack(attacker, defender, DamageType::Fire, 4.f, rng2);
+					if (result1.hit != result2.hit || result1.damage != result2.damage)
+					{
+						return "different results for the same seed";
+					}
+				}
+				return {};
+			});
+	}
+}
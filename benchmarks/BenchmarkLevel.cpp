@@ -0,0 +1,498 @@
+#include "BenchmarkFixtures.h"
+#include "Benchmarks.h"
+#include <cstdio>
+#include "Game/Level/DungeonGenerator.h"
+#include "Game/Level/Level.h"
+#include "Game/Level/LevelMap.h"
+#include "Game/Level/LevelObjectManager.h"
+#include "Game/Player/Player.h"
+#include "Game/Player/PlayerMove.h"
+#include "Game/Projectile/Projectile.h"
+#include "Game/SimpleLevelObject/SimpleLevelObject.h"
+#include "Json/JsonUtils.h"
+#include <memory>
+#include "Parser/Level/ParseLevelLayer.h"
+#include <SFML/Graphics/Texture.hpp>
+
+namespace Benchmark
+{
+	using namespace rapidjson;
+	using namespace std::literals;
+
+	namespace
+	{
+		constexpr int32_t MapSize = 128;
+
+		// open map with vertical walls every 16 columns. each wall has a single gap,
+		// alternating between the top and the bottom, so long paths have to zigzag.
+		LevelMap makeWalledMap()
+		{
+			LevelMap map(MapSize, MapSize);
+			for (int32_t x = 16; x < MapSize; x += 16)
+			{
+				auto gapY = ((x / 16) % 2 == 0 ? 2 : MapSize - 3);
+				for (int32_t y = 0; y < MapSize; y++)
+				{
+					if (y != gapY)
+					{
+						map[PairInt32(x, y)].setTileIndex(LevelCell::FlagsLayer, 1);
+					}
+				}
+			}
+			return map;
+		}
+
+		// map with level objects that emit light.
+		struct LightsFixture
+		{
+			static constexpr int32_t NumLights = 256;
+
+			sf::Texture texture;
+			SimpleLevelObjectClass objClass{ texture };
+			LevelMap map{ MapSize, MapSize };
+			LevelObjectManager levelObjects;
+
+			LightsFixture()
+			{
+				map.setDefaultTileSize(64, 32, 1);
+				objClass.setLightSource({ 128, 6 });
+				for (int32_t i = 0; i < NumLights; i++)
+				{
+					auto obj = std::make_shared<SimpleLevelObject>(&objClass);
+					obj->MapPosition(map, PairFloat(
+						(float)((i * 37) % MapSize),
+						(float)((i * 91) % MapSize)
+					));
+					levelObjects.add(map, obj);
+				}
+			}
+		};
+
+		// projectiles flying across the walled map. expired ones are fired again.
+		struct ProjectilesFixture
+		{
+			static constexpr int32_t NumProjectiles = 512;
+
+			Spell spell{ nullptr, nullptr, 0, 0 };
+			LevelMap map{ makeWalledMap() };
+			std::vector<std::unique_ptr<Projectile>> projectiles;
+			uint32_t numFired{ 0 };
+
+			ProjectilesFixture()
+			{
+				spell.SpellType("fire");
+				for (int32_t i = 0; i < NumProjectiles; i++)
+				{
+					projectiles.push_back(std::make_unique<Projectile>(&spell));
+					fire(*projectiles.back());
+				}
+			}
+
+			void fire(Projectile& projectile)
+			{
+				auto i = numFired++;
+				PairFloat origin((float)((i * 37) % MapSize) + 0.5f, (float)((i * 91) % MapSize) + 0.5f);
+				PairFloat target((float)((i * 53) % MapSize) + 0.5f, (float)((i * 17) % MapSize) + 0.5f);
+				projectile.init(&spell, nullptr, origin, target, 10, 16, 2000, 0);
+			}
+		};
+
+		// fires a projectile at a player on an open map and steps it until it expires.
+		// returns the number of hits.
+		uint32_t getProjectileHits(const PairFloat& origin, const PairFloat& target,
+			LevelObjValue speed, LevelObjValue duration, LevelObjValue hitInterval)
+		{
+			Level level;
+			PlayerClass playerClass;
+			Spell spell{ nullptr, nullptr, 0, 0 };
+			spell.SpellType("fire");
+			LevelMap map(16, 16);
+			auto player = std::make_shared<Player>(&playerClass, level);
+			player->MapPosition(map, PairFloat(8.f, 8.f));
+
+			Projectile projectile(&spell);
+			projectile.init(&spell, nullptr, origin, target, 10, speed, duration, hitInterval);
+			auto elapsedTime = sf::milliseconds(10);
+			for (int i = 0; i < 1000 && projectile.step(map, elapsedTime) == true; i++) {}
+			return projectile.HitCount();
+		}
+
+		DungeonParams getDungeonParams(DungeonType type)
+		{
+			DungeonParams params;
+			params.type = type;
+			params.tiles.empty = 0;
+			params.tiles.floor = { 1, 2, 3 };
+			params.tiles.wall = { 4 };
+			params.tiles.door = { 5 };
+			return params;
+		}
+
+		uint64_t getDungeonHash(const DungeonParams& params)
+		{
+			auto layout = DungeonGenerator::generate(params);
+			auto tiles = DungeonGenerator::getTiles(layout, params.tiles, params.seed);
+			return DungeonGenerator::hash(tiles);
+		}
+
+		// object that blocks its cell, like a player.
+		class Walker final : public LevelObject
+		{
+		public:
+			std::vector<PairFloat> walkPath;
+			sf::Time blockedTime;
+			uint8_t repaths{ 0 };
+
+			Walker(const LevelObjectClass* class__) : LevelObject(class__, LevelObjectType::Unknown) {}
+
+			bool Passable() const noexcept override { return false; }
+			const std::string_view getType() const override { return "walker"; }
+			void update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr) override {}
+
+			bool getProperty(const std::string_view prop, Variable& var) const override { return false; }
+			bool getNumberByHash(const Queryable& owner, uint16_t propHash, LevelObjValue& value) const override { return false; }
+		};
+
+		// walkers crossing the walled map between its left and right sides.
+		// an iteration is a level update, with one walk step per walker.
+		// with avoidance, walkers behave like the level's AI players: blocked walkers
+		// walk around the blocking object or wait (PlayerMove::onBlockedStep) and
+		// path searches use the update's AI path budget. without it, blocked walkers
+		// search a new path right away, as players did before.
+		struct CrowdFixture
+		{
+			static constexpr int32_t NumWalkers = 500;
+			// ms per walk step. 8 blocked steps before a new path search.
+			static constexpr int32_t StepTime = 50;
+
+			sf::Texture texture;
+			SimpleLevelObjectClass objClass{ texture };
+			LevelMap map{ makeWalledMap() };
+			std::vector<std::unique_ptr<Walker>> walkers;
+			bool avoidance;
+			uint32_t pathBudget{ 0 };
+			uint64_t numPathSearches{ 0 };
+
+			CrowdFixture(bool avoidance_) : avoidance(avoidance_)
+			{
+				for (int32_t i = 0; i < NumWalkers; i++)
+				{
+					auto walker = std::make_unique<Walker>(&objClass);
+					walker->MapPosition(map, PairFloat((float)(i % 8), (float)((i / 8) * 2 % MapSize)));
+					walkers.push_back(std::move(walker));
+				}
+			}
+
+			// returns false if the update's path budget is used up.
+			bool getPath(const Walker& walker, const PairFloat& goal, std::vector<PairFloat>& path)
+			{
+				if (avoidance == true)
+				{
+					if (pathBudget == 0)
+					{
+						return false;
+					}
+					pathBudget--;
+				}
+				numPathSearches++;
+				path = map.getPath(walker.MapPosition(), goal);
+				return true;
+			}
+
+			void update()
+			{
+				pathBudget = Level::MaxAIPathsPerUpdate;
+				for (auto& walker : walkers)
+				{
+					step(*walker);
+				}
+			}
+
+			void step(Walker& walker)
+			{
+				if (walker.walkPath.empty() == true)
+				{
+					auto goalX = walker.MapPosition().x < MapSize / 2 ? MapSize - 1 : 0;
+					PairFloat goal((float)goalX, walker.MapPosition().y);
+					walker.blockedTime = sf::Time::Zero;
+					walker.repaths = 0;
+					getPath(walker, goal, walker.walkPath);
+					return;
+				}
+				if (walker.walkPath.back() == walker.MapPosition())
+				{
+					walker.walkPath.pop_back();
+					return;
+				}
+				if (avoidance == false)
+				{
+					if (map[walker.walkPath.back()].Passable() == false)
+					{
+						auto goal = walker.walkPath.front();
+						getPath(walker, goal, walker.walkPath);
+						return;
+					}
+				}
+				else if (map.avoidBlockedStep(walker, walker.walkPath) == false)
+				{
+					waitOnBlockedStep(walker);
+					return;
+				}
+				walker.blockedTime = sf::Time::Zero;
+				walker.MapPosition(map, walker.walkPath.back());
+				walker.walkPath.pop_back();
+			}
+
+			// same as PlayerMove::waitOnBlockedStep
+			void waitOnBlockedStep(Walker& walker)
+			{
+				switch (PlayerMove::onBlockedStep(walker.blockedTime, walker.repaths, sf::milliseconds(StepTime)))
+				{
+				case PlayerMove::BlockedStep::Wait:
+					return;
+				case PlayerMove::BlockedStep::Repath:
+				{
+					std::vector<PairFloat> path;
+					if (getPath(walker, walker.walkPath.front(), path) == false)
+					{
+						return;
+					}
+					walker.blockedTime = sf::Time::Zero;
+					if (path.empty() == false)
+					{
+						walker.repaths++;
+						walker.walkPath = std::move(path);
+						return;
+					}
+					break;
+				}
+				default:
+					walker.blockedTime = sf::Time::Zero;
+					break;
+				}
+				walker.walkPath.clear();
+			}
+		};
+
+		struct LevelJsonFixture
+		{
+			std::string mapJson;
+			Document mapDoc;
+			Document layersDoc;
+			const Value* layersElem{ nullptr };
+
+			LevelJsonFixture()
+			{
+				mapJson = Fixtures::readFile(Fixtures::getDataPath(
+					"gamefilesflare/level/data/empyrean_campaign/lake_kuuma.json"));
+				if (JsonUtils::loadJson(mapJson, mapDoc) == false)
+				{
+					return;
+				}
+				auto layersJson = Fixtures::readFile(Fixtures::getDataPath(
+					"gamefilesflare/level/default/flare/load5Layers.json"));
+				if (JsonUtils::loadJson(layersJson, layersDoc) == false ||
+					layersDoc.HasMember("level"sv) == false ||
+					layersDoc["level"sv].HasMember("map"sv) == false)
+				{
+					return;
+				}
+				layersElem = &layersDoc["level"sv]["map"sv];
+			}
+		};
+	}
+
+	void registerLevelBenchmarks(Runner& runner)
+	{
+		auto walledMap = std::make_shared<LevelMap>(makeWalledMap());
+		runner.add("levelmap.getPath.short", [walledMap](uint64_t numIterations)
+			{
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					doNotOptimize(walledMap->getPath(PairFloat(20.f, 20.f), PairFloat(28.f, 30.f)));
+				}
+			});
+		runner.add("levelmap.getPath.long", [walledMap](uint64_t numIterations)
+			{
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					doNotOptimize(walledMap->getPath(PairFloat(2.f, 64.f), PairFloat(125.f, 64.f)));
+				}
+			});
+		runner.add("levelmap.hasLineOfSight", [walledMap](uint64_t numIterations)
+			{
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					auto y = (int32_t)(i % MapSize);
+					doNotOptimize(walledMap->hasLineOfSight(PairInt32(4, y), PairInt32(30, MapSize - 1 - y)));
+				}
+			});
+
+		auto visibleMap = std::make_shared<LevelMap>(makeWalledMap());
+		runner.add("levelmap.updateVisibleCells", [visibleMap](uint64_t numIterations)
+			{
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					// a different cell every time, so it's never skipped.
+					auto x = (float)(i % MapSize);
+					visibleMap->updateVisibleCells(PairFloat(x, (float)(MapSize / 2)), 10);
+				}
+				doNotOptimize(visibleMap->ExploredVersion());
+			});
+
+		for (auto avoidance : { true, false })
+		{
+			auto crowd = std::make_shared<CrowdFixture>(avoidance);
+			runner.add(avoidance == true ? "levelmap.crowd.avoid" : "levelmap.crowd.repath",
+				[crowd](uint64_t numIterations)
+				{
+					for (uint64_t i = 0; i < numIterations; i++)
+					{
+						crowd->update();
+					}
+					doNotOptimize(crowd->numPathSearches);
+				},
+				{ { "path searches", [crowd]() { return crowd->numPathSearches; } } });
+		}
+
+		for (auto type : { DungeonType::Rooms, DungeonType::Caves })
+		{
+			runner.add(type == DungeonType::Rooms ? "dungeon.generate.rooms" : "dungeon.generate.caves",
+				[type](uint64_t numIterations)
+				{
+					auto params = getDungeonParams(type);
+					for (uint64_t i = 0; i < numIterations; i++)
+					{
+						params.seed = i % 16;
+						doNotOptimize(getDungeonHash(params));
+					}
+				});
+		}
+
+		// the same seed gives the same map, on every run and platform.
+		// the hashes change if the generator changes and have to be updated.
+		runner.addCheck("dungeon.generate.deterministic", []() -> std::string
+			{
+				struct Case
+				{
+					DungeonType type;
+					uint64_t seed;
+					uint64_t hash;
+				};
+				const Case cases[] = {
+					{ DungeonType::Rooms, 1, 0x1078c78b53392cd0ULL },
+					{ DungeonType::Rooms, 2, 0x67fee9f8bb8b0506ULL },
+					{ DungeonType::Rooms, 3, 0x91de6f0e4c40d1c6ULL },
+					{ DungeonType::Rooms, 1234, 0x1ff30768d5c53851ULL },
+					{ DungeonType::Caves, 1, 0x41a836a95bd62120ULL },
+					{ DungeonType::Caves, 2, 0x9208ec5c5352fdf7ULL },
+					{ DungeonType::Caves, 3, 0x99ecaf7a087da464ULL },
+					{ DungeonType::Caves, 1234, 0xeccfc4754de88253ULL },
+				};
+				for (const auto& c : cases)
+				{
+					auto params = getDungeonParams(c.type);
+					params.seed = c.seed;
+					auto hash1 = getDungeonHash(params);
+					auto hash2 = getDungeonHash(params);
+					std::string name = (c.type == DungeonType::Rooms ? "rooms" : "caves");
+					name += " seed " + std::to_string(c.seed);
+					if (hash1 != hash2)
+					{
+						return name + ": different maps for the same seed";
+					}
+					if (hash1 != c.hash)
+					{
+						char hashStr[32];
+						std::snprintf(hashStr, sizeof(hashStr), "0x%016llx", (unsigned long long)hash1);
+						return name + ": hash " + hashStr + " doesn't match the pinned hash";
+					}
+				}
+				return {};
+			});
+
+		auto lights = std::make_shared<LightsFixture>();
+		runner.add("levelmap.updateLights", [lights](uint64_t numIterations)
+			{
+				auto drawCenter = lights->map.toDrawCoord(PairFloat(64.f, 64.f));
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					lights->map.updateLights(lights->levelObjects, drawCenter);
+					doNotOptimize(lights->map.AllLights());
+				}
+			});
+
+		auto projectiles = std::make_shared<ProjectilesFixture>();
+		runner.add("projectile.step", [projectiles](uint64_t numIterations)
+			{
+				auto elapsedTime = sf::milliseconds(16);
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					for (auto& projectile : projectiles->projectiles)
+					{
+						if (projectile->step(projectiles->map, elapsedTime) == false)
+						{
+							projectiles->fire(*projectile);
+						}
+					}
+				}
+				doNotOptimize(projectiles->numFired);
+			});
+
+		runner.addCheck("projectile.hitsPerLifetime", []() -> std::string
+			{
+				PairFloat center(8.5f, 8.5f);
+				struct Case
+				{
+					const char* name;
+					PairFloat origin;
+					LevelObjValue speed;
+					LevelObjValue hitInterval;
+					uint32_t hits;
+				};
+				// 1000 ms lifetime, 10 ms steps
+				const Case cases[] = {
+					{ "moving", PairFloat(2.5f, 8.5f), 16, 0, 1 },
+					{ "area effect without hit interval", center, 0, 0, 1 },
+					{ "area effect with a 300 ms hit interval", center, 0, 300, 4 },
+				};
+				for (const auto& c : cases)
+				{
+					auto hits = getProjectileHits(c.origin, center, c.speed, 1000, c.hitInterval);
+					if (hits != c.hits)
+					{
+						return std::string(c.name) + ": " + std::to_string(hits) +
+							" hits, expected " + std::to_string(c.hits);
+					}
+				}
+				return {};
+			});
+
+		auto levelJson = std::make_shared<LevelJsonFixture>();
+		if (levelJson->layersElem == nullptr)
+		{
+			runner.skip("json.parse.level", "bundled level files not found");
+			runner.skip("level.parseMapLayers", "bundled level files not found");
+			return;
+		}
+		runner.add("json.parse.level", [levelJson](uint64_t numIterations)
+			{
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					Document doc;
+					JsonUtils::loadJson(levelJson->mapJson, doc);
+					doNotOptimize(doc);
+				}
+			});
+		runner.add("level.parseMapLayers", [levelJson](uint64_t numIterations)
+			{
+				for (uint64_t i = 0; i < numIterations; i++)
+				{
+					LevelMap map(0, 0);
+					Parser::parseMapLayers(map, &levelJson->mapDoc,
+						*levelJson->layersElem, {}, -1, true);
+					doNotOptimize(map);
+				}
+			});
+	}
+}
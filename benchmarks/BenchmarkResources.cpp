@@ -0,0 +1,254 @@
+#include "BenchmarkFixtures.h"
+#include "Benchmarks.h"
+#include "Game/Utils/FileUtils.h"
+#include <memory>
+#include "Resources/BitmapFont.h"
+#ifdef DGENGINE_DIABLO_FORMAT_SUPPORT
+#include "Resources/ImageContainers/CELImageContainer.h"
+#include "Resources/ImageContainers/CL2ImageContainer.h"
+#include "Resources/ImageContainers/DC6ImageContainer.h"
+#include "Resources/ImageContainers/DCCImageContainer.h"
+#endif
+#include "Resources/TexturePacks/BitmapFontTexturePack.h"
+#include <SFML/Graphics/Texture.hpp>
+#ifndef DGENGINE_MOVIE_STUB
+#include "SFML/sfeMovie/Movie.hpp"
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+#endif
+
+namespace Benchmark
+{
+	namespace
+	{
+		// decodes every frame of the image container, one per iteration.
+		void addImageContainer(Runner& runner, const std::string_view name,
+			std::shared_ptr<ImageContainer> imgContainer)
+		{
+			if (imgContainer == nullptr || imgContainer->size() == 0)
+			{
+				runner.skip(name, "invalid image container");
+				return;
+			}
+			auto palette = std::make_shared<PaletteArray>(Fixtures::makePalette());
+			runner.add(name, [imgContainer, palette](uint64_t numIterations)
+				{
+					ImageContainer::ImageInfo imgInfo;
+					auto numFrames = imgContainer->size();
+					for (uint64_t i = 0; i < numIterations; i++)
+					{
+						auto img = imgContainer->get((uint32_t)(i % numFrames), palette.get(), imgInfo);
+						doNotOptimize(img);
+					}
+				});
+		}
+
+		void registerImageContainerBenchmarks(Runner& runner, const Options& options)
+		{
+#ifdef DGENGINE_DIABLO_FORMAT_SUPPORT
+			addImageContainer(runner, "cel.decode",
+				std::make_shared<CELImageContainer>(Fixtures::makeCEL(16, 64, 128)));
+			addImageContainer(runner, "cl2.decode",
+				std::make_shared<CL2ImageContainer>(Fixtures::makeCL2(16, 96, 128)));
+			addImageContainer(runner, "dc6.decode",
+				std::make_shared<DC6ImageContainer>(Fixtures::makeDC6(8, 2, 96, 112), false, true));
+
+			if (options.dccFile.empty() == true)
+			{
+				runner.skip("dcc.decode", "no DCC file (--dcc:<file>)");
+			}
+			else
+			{
+				addImageContainer(runner, "dcc.decode",
+					std::make_shared<DCCImageContainer>(Fixtures::readFileBytes(options.dccFile)));
+			}
+#else
+			for (auto name : { "cel.decode", "cl2.decode", "dc6.decode", "dcc.decode" })
+			{
+				runner.skip(name, "built without Diablo file format support");
+			}
+#endif
+		}
+
+		void registerArchiveBenchmarks(Runner& runner, const Options& options)
+		{
+			if (options.archive.empty() == true ||
+				options.archiveFile.empty() == true)
+			{
+				runner.skip("archive.read", "no archive (--archive:<archive>|<file>)");
+				return;
+			}
+			if (FileUtils::mount(options.archive, "", false) == false)
+			{
+				runner.skip("archive.read", "archive could not be mounted");
+				return;
+			}
+			if (FileUtils::exists(options.archiveFile.c_str()) == false)
+			{
+				runner.skip("archive.read", "file not found in archive");
+				return;
+			}
+			auto file = options.archiveFile;
+			runner.add("archive.read", [file](uint64_t numIterations)
+				{
+					for (uint64_t i = 0; i < numIterations; i++)
+					{
+						doNotOptimize(FileUtils::readChar(file));
+					}
+				});
+		}
+
+		// 16x16 cell font. the texture is empty (not needed to build vertices).
+		std::shared_ptr<BitmapFont> makeBitmapFont()
+		{
+			std::vector<uint8_t> charSizes(256);
+			for (size_t i = 0; i < charSizes.size(); i++)
+			{
+				charSizes[i] = (uint8_t)(6 + (i % 7));
+			}
+			auto texturePack = std::make_shared<BitmapFontTexturePack>(
+				std::make_shared<sf::Texture>(), nullptr, 16, 16,
+				(int16_t)16, (int16_t)8, (int16_t)32, false, charSizes, 0, 1);
+			return std::make_shared<BitmapFont>(texturePack, 16, 8, 32);
+		}
+
+		void registerBitmapFontBenchmarks(Runner& runner)
+		{
+			auto font = makeBitmapFont();
+
+			// more texts than the layout cache can hold, so every call is laid out.
+			auto texts = std::make_shared<std::vector<std::string>>();
+			for (int i = 0; i < 64; i++)
+			{
+				texts->push_back("Quest " + std::to_string(i) +
+					": The Butcher\nSlay the Butcher on the second level of the cathedral.\n"
+					"Reward: 1500 gold pieces and a ring of the heavens.");
+			}
+
+			runner.add("bitmapfont.layout", [font, texts](uint64_t numIterations)
+				{
+					std::vector<sf::Vertex> vertices;
+					for (uint64_t i = 0; i < numIterations; i++)
+					{
+						const auto& text = (*texts)[i % texts->size()];
+						font->updateVertexString(vertices, text, sf::Color::White,
+							0, 0, 320.f, HorizontalAlign::Center);
+						doNotOptimize(vertices);
+					}
+				});
+			runner.add("bitmapfont.layout.cached", [font, texts](uint64_t numIterations)
+				{
+					std::vector<sf::Vertex> vertices;
+					const auto& text = texts->front();
+					for (uint64_t i = 0; i < numIterations; i++)
+					{
+						font->updateVertexString(vertices, text, sf::Color::White,
+							0, 0, 320.f, HorizontalAlign::Center);
+						doNotOptimize(vertices);
+					}
+				});
+		}
+
+#ifndef DGENGINE_MOVIE_STUB
+		// plays the movie and verifies that frames are decoded by the worker thread
+		// and that every decoded frame is either shown, dropped or still queued.
+		std::string checkMovieDecode(const std::string& file)
+		{
+			// size of the decoded frame queue of the video stream.
+			static constexpr uint64_t frameQueueSize = 4;
+
+			sfe::Movie movie;
+			if (movie.openFromFile(file) == false)
+			{
+				return "could not open " + file;
+			}
+			if (movie.getSize().x <= 0.f || movie.getSize().y <= 0.f)
+			{
+				return "no video stream";
+			}
+
+			auto playFor = [&movie](int milliseconds)
+			{
+				sf::Clock clock;
+				while (clock.getElapsedTime() < sf::milliseconds(milliseconds) &&
+					movie.getStatus() == sfe::Status::Playing)
+				{
+					movie.update();
+					sf::sleep(sf::milliseconds(5));
+				}
+			};
+
+			// the first update starts the worker, which then fills the queue
+			// while the main thread doesn't call update.
+			movie.play();
+			movie.update();
+			sf::sleep(sf::milliseconds(200));
+			auto decoded = movie.getDecodedFrameCount();
+			if (decoded == 0)
+			{
+				return "no frames decoded while the main thread was idle";
+			}
+			if (decoded > frameQueueSize)
+			{
+				return "decoded " + std::to_string(decoded) + " frames into a queue of " +
+					std::to_string(frameQueueSize);
+			}
+
+			playFor(1000);
+			decoded = movie.getDecodedFrameCount();
+			auto displayed = movie.getDisplayedFrameCount();
+			auto used = displayed + movie.getDroppedFrameCount();
+			if (displayed == 0)
+			{
+				return "no frames displayed";
+			}
+			if (used > decoded || decoded - used > frameQueueSize)
+			{
+				return "decoded " + std::to_string(decoded) + " frames, but " +
+					std::to_string(used) + " were displayed or dropped";
+			}
+
+			// seeking parks the worker and flushes the queue. decoding must resume.
+			if (movie.getStatus() == sfe::Status::Playing)
+			{
+				if (movie.setPlayingOffset(movie.getDuration() / 2.f) == false)
+				{
+					return "seek failed";
+				}
+				playFor(500);
+				if (movie.getDisplayedFrameCount() == displayed)
+				{
+					return "no frames displayed after seeking";
+				}
+			}
+
+			// stopping parks the worker, destroying the movie joins it.
+			movie.stop();
+			return {};
+		}
+#endif
+
+		void registerMovieChecks(Runner& runner, const Options& options)
+		{
+#ifndef DGENGINE_MOVIE_STUB
+			if (options.movieFile.empty() == true)
+			{
+				runner.skipCheck("movie.decodeOnWorker", "no movie file (--movie:<file>)");
+				return;
+			}
+			auto file = options.movieFile;
+			runner.addCheck("movie.decodeOnWorker", [file]() { return checkMovieDecode(file); });
+#else
+			runner.skipCheck("movie.decodeOnWorker", "built without movie support");
+#endif
+		}
+	}
+
+	void registerResourceBenchmarks(Runner& runner, const Options& options)
+	{
+		registerImageContainerBenchmarks(runner, options);
+		registerArchiveBenchmarks(runner, options);
+		registerBitmapFontBenchmarks(runner);
+		registerMovieChecks(runner, options);
+	}
+}
@@ -0,0 +1,100 @@
+#include "BenchmarkFixtures.h"
+#include "Benchmarks.h"
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include "Utils/UnorderedStringMap.h"
+
+namespace Benchmark
+{
+	namespace
+	{
+		// std::unordered_map with the same hash and string_view lookups,
+		// which is what UnorderedStringMap used to be.
+		template <class T>
+		using StdStringMap = std::unordered_map<std::string, T, StringViewHashEq, StringViewHashEq>;
+
+		struct StringIds
+		{
+			std::vector<std::string> ids;
+			// ids that aren't in the maps (ids with a suffix).
+			std::vector<std::string> missingIds;
+		};
+
+		template <class Map>
+		void addStringMap(Runner& runner, const std::string_view name,
+			const std::shared_ptr<StringIds>& stringIds)
+		{
+			auto map = std::make_shared<Map>();
+			for (size_t i = 0; i < stringIds->ids.size(); i++)
+			{
+				map->emplace(stringIds->ids[i], i);
+			}
+
+			runner.add(std::string(name) + ".find", [map, stringIds](uint64_t numIterations)
+				{
+					const auto& ids = stringIds->ids;
+					for (uint64_t i = 0; i < numIterations; i++)
+					{
+						auto it = map->find(std::string_view(ids[i % ids.size()]));
+						doNotOptimize(it->second);
+					}
+				});
+			runner.add(std::string(name) + ".findMissing", [map, stringIds](uint64_t numIterations)
+				{
+					const auto& ids = stringIds->missingIds;
+					for (uint64_t i = 0; i < numIterations; i++)
+					{
+						doNotOptimize(map->find(std::string_view(ids[i % ids.size()])) == map->end());
+					}
+				});
+			// builds the whole map, one id per iteration.
+			runner.add(std::string(name) + ".insert", [stringIds](uint64_t numIterations)
+				{
+					const auto& ids = stringIds->ids;
+					Map insertMap;
+					for (uint64_t i = 0; i < numIterations; i++)
+					{
+						auto idx = i % ids.size();
+						if (idx == 0)
+						{
+							insertMap.clear();
+						}
+						doNotOptimize(insertMap.emplace(ids[idx], idx).second);
+					}
+				});
+		}
+	}
+
+	void registerUtilsBenchmarks(Runner& runner)
+	{
+		// ids of the UI, resources and level objects of the bundled game
+		auto stringIds = std::make_shared<StringIds>();
+		stringIds->ids = Fixtures::getJsonIds(Fixtures::getDataPath("gamefilesd"));
+		if (stringIds->ids.empty() == true)
+		{
+			for (auto name : { "stringmap", "stringmap.std" })
+			{
+				for (auto op : { ".find", ".findMissing", ".insert" })
+				{
+					runner.skip(std::string(name) + op, "no ids found in gamefilesd");
+				}
+			}
+			return;
+		}
+		std::unordered_set<std::string_view> idSet(stringIds->ids.begin(), stringIds->ids.end());
+		stringIds->missingIds.reserve(stringIds->ids.size());
+		for (const auto& id : stringIds->ids)
+		{
+			auto missingId = id + '~';
+			while (idSet.contains(missingId) == true)
+			{
+				missingId += '~';
+			}
+			stringIds->missingIds.push_back(std::move(missingId));
+		}
+
+		addStringMap<UnorderedStringMap<size_t>>(runner, "stringmap", stringIds);
+		addStringMap<StdStringMap<size_t>>(runner, "stringmap.std", stringIds);
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Benchmark.h"
+#include <string>
+
+namespace Benchmark
+{
+	struct Options
+	{
+		// archive (MPQ, zip, folder) to mount and file to read from it.
+		std::string archive;
+		std::string archiveFile;
+		// DCC file on disk.
+		std::string dccFile;
+		// movie file on disk.
+		std::string movieFile;
+	};
+
+	// Formula, Classifier, Inventory, combat
+	void registerGameBenchmarks(Runner& runner);
+
+	// LevelMap, projectiles, level parsing
+	void registerLevelBenchmarks(Runner& runner);
+
+	// image containers, archive reads, bitmap fonts, movies
+	void registerResourceBenchmarks(Runner& runner, const Options& options);
+
+	// containers (UnorderedStringMap)
+	void registerUtilsBenchmarks(Runner& runner);
+}
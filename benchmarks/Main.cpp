@@ -0,0 +1,131 @@
+#include <algorithm>
+#include "Benchmarks.h"
+#include <fstream>
+#include "Game/Utils/FileUtils.h"
+#include <iostream>
+#include "RegisterHooks.h"
+#include "Utils/StringHash.h"
+#include "Utils/Utils.h"
+
+// usage: DGEngine.bench [options]
+// --filter:<text>                only run benchmarks whose name contains text
+// --samples:<n>                  number of samples per benchmark (default 15)
+// --minTime:<ms>                 minimum time of a sample (default 10)
+// --format:<text|json|csv>       output format (default text)
+// --output:<file>                write the results to a file instead of stdout
+// --archive:<archive>|<file>     mount an archive (MPQ, zip, folder) and read a file from it
+// --dcc:<file>                   DCC file to decode
+// --movie:<file>                 movie file to decode on the movie worker thread
+// --checks                       only run the checks (exits with 1 if one fails)
+// --list                         list the benchmarks and checks and exit
+int main(int argc, char* argv[])
+{
+	Hooks::registerHooks();
+
+	FileUtils::initPhysFS(argv[0]);
+
+	int exitCode = 0;
+
+	try
+	{
+		Benchmark::Runner runner;
+		Benchmark::Options options;
+		auto format = Benchmark::OutputFormat::Text;
+		std::string outputFile;
+		bool listOnly = false;
+		bool checksOnly = false;
+
+		for (int i = 1; i < argc; i++)
+		{
+			auto arg = Utils::splitStringIn2(std::string_view(argv[i]), ':');
+			switch (str2int16(arg.first))
+			{
+			case str2int16("--filter"):
+				runner.filter = arg.second;
+				break;
+			case str2int16("--samples"):
+				runner.numSamples = std::max(Utils::strtou(arg.second), 1u);
+				break;
+			case str2int16("--minTime"):
+				runner.minSampleTime = std::chrono::milliseconds(Utils::strtou(arg.second));
+				break;
+			case str2int16("--format"):
+			{
+				if (arg.second == "json")
+				{
+					format = Benchmark::OutputFormat::Json;
+				}
+				else if (arg.second == "csv")
+				{
+					format = Benchmark::OutputFormat::Csv;
+				}
+				break;
+			}
+			case str2int16("--output"):
+				outputFile = arg.second;
+				break;
+			case str2int16("--archive"):
+			{
+				auto archive = Utils::splitStringIn2(arg.second, '|');
+				options.archive = archive.first;
+				options.archiveFile = archive.second;
+				break;
+			}
+			case str2int16("--dcc"):
+				options.dccFile = arg.second;
+				break;
+			case str2int16("--movie"):
+				options.movieFile = arg.second;
+				break;
+			case str2int16("--checks"):
+				checksOnly = true;
+				break;
+			case str2int16("--list"):
+				listOnly = true;
+				break;
+			default:
+				std::cerr << "unknown option: " << argv[i] << '\n';
+				break;
+			}
+		}
+
+		Benchmark::registerGameBenchmarks(runner);
+		Benchmark::registerLevelBenchmarks(runner);
+		Benchmark::registerResourceBenchmarks(runner, options);
+		Benchmark::registerUtilsBenchmarks(runner);
+
+		if (listOnly == true)
+		{
+			runner.list(std::cout);
+		}
+		else
+		{
+			// checks go to stderr so they don't mix with json/csv results.
+			if (Benchmark::write(std::cerr, runner.runChecks()) == false)
+			{
+				exitCode = 1;
+			}
+			if (checksOnly == false)
+			{
+				auto results = runner.run();
+				if (outputFile.empty() == false)
+				{
+					std::ofstream file(outputFile, std::ios::trunc);
+					Benchmark::write(file, results, format);
+				}
+				else
+				{
+					Benchmark::write(std::cout, results, format);
+				}
+			}
+		}
+	}
+	catch (std::exception& ex)
+	{
+		std::cerr << ex.what();
+		exitCode = 1;
+	}
+
+	FileUtils::deinitPhysFS();
+	return exitCode;
+}
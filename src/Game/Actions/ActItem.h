@@ -310,7 +310,7 @@ public:
 
 					if (player != nullptr)
 					{
-						player->updateProperties();
+						player->updateProperties(PlayerInputs::Items);
 					}
 				}
 			}
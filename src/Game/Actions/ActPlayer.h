@@ -118,6 +118,82 @@ public:
 	}
 };
 
+class ActPlayerAttack : public Action
+{
+private:
+	std::string idPlayer;
+	std::string idLevel;
+	std::string idTarget;
+	PlayerAnimation attackAnimation;
+	DamageType damageType;
+	bool ranged;
+
+public:
+	ActPlayerAttack(const std::string_view idPlayer_, const std::string_view idLevel_,
+		const std::string_view idTarget_, PlayerAnimation attackAnimation_,
+		DamageType damageType_, bool ranged_)
+		: idPlayer(idPlayer_), idLevel(idLevel_), idTarget(idTarget_),
+		attackAnimation(attackAnimation_), damageType(damageType_), ranged(ranged_) {}
+
+	bool execute(Game& game) override
+	{
+		auto level = game.Resources().getLevel<Level>(idLevel);
+		if (level != nullptr)
+		{
+			auto player = level->getPlayerOrCurrent(idPlayer);
+			auto target = std::dynamic_pointer_cast<PlayerBase>(
+				level->LevelObjects().getByQueryId(idTarget));
+			if (player != nullptr && target != nullptr)
+			{
+				player->Attack(target, attackAnimation, damageType, ranged);
+			}
+		}
+		return true;
+	}
+};
+
+class ActPlayerCastSpell : public Action
+{
+private:
+	std::string idPlayer;
+	std::string idLevel;
+	std::string idSpell;
+	std::string idTarget;
+
+public:
+	ActPlayerCastSpell(const std::string_view idPlayer_, const std::string_view idLevel_,
+		const std::string_view idSpell_, const std::string_view idTarget_)
+		: idPlayer(idPlayer_), idLevel(idLevel_), idSpell(idSpell_), idTarget(idTarget_) {}
+
+	bool execute(Game& game) override
+	{
+		auto level = game.Resources().getLevel<Level>(idLevel);
+		if (level != nullptr)
+		{
+			auto player = level->getPlayerOrCurrent(idPlayer);
+			if (player != nullptr)
+			{
+				auto spellInstance = (idSpell.empty() == true ?
+					player->SelectedSpell() : player->getSpellInstance(idSpell));
+				if (spellInstance != nullptr)
+				{
+					auto targetPos = level->getMapCoordOverMouse();
+					if (auto target = level->LevelObjects().getByQueryId(idTarget))
+					{
+						targetPos = target->MapPosition();
+					}
+					if (targetPos != player->MapPosition())
+					{
+						player->setDirection(getPlayerDirection(player->MapPosition(), targetPos));
+					}
+					level->addProjectile(*spellInstance, player, targetPos);
+				}
+			}
+		}
+		return true;
+	}
+};
+
 class ActPlayerMove : public Action
 {
 private:
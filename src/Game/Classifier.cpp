@@ -1,72 +1,156 @@
 #include "Classifier.h"
+#include "Utils/StringHash.h"
+
+Classifier::Classifier(std::vector<ClassifierValueInterval> intervals)
+{
+	size_t numEntries = 0;
+	for (const auto& interval : intervals)
+	{
+		numEntries += interval.values.size();
+	}
+	properties.reserve(intervals.size());
+	entries.reserve(numEntries);
+	values.reserve(numEntries);
+
+	for (auto& interval : intervals)
+	{
+		Property prop;
+		auto dotPos = interval.property.find('.');
+		if (dotPos != std::string::npos)
+		{
+			prop.hash = str2int16(std::string_view(interval.property).substr(0, dotPos));
+			prop.argsOffset = dotPos + 1;
+		}
+		else
+		{
+			prop.hash = str2int16(interval.property);
+			prop.argsOffset = interval.property.size();
+		}
+		prop.name = std::move(interval.property);
+		prop.firstEntry = (uint32_t)entries.size();
+		prop.numEntries = (uint32_t)interval.values.size();
+
+		for (auto& classVal : interval.values)
+		{
+			CompareEntry entry;
+			if (std::holds_alternative<ClassifierValue::ValuePair>(classVal.compare) == true)
+			{
+				const auto& minMax = std::get<ClassifierValue::ValuePair>(classVal.compare);
+				entry.min = minMax.first;
+				entry.max = minMax.second;
+			}
+			else
+			{
+				entry.stringId = getStringId(std::get<std::string>(classVal.compare));
+			}
+			entry.valueIdx = (uint32_t)values.size();
+			entries.push_back(entry);
+			values.push_back(std::move(classVal.value));
+		}
+		properties.push_back(std::move(prop));
+	}
+}
+
+uint32_t Classifier::getStringId(const std::string& str)
+{
+	auto it = stringIds.find(str);
+	if (it != stringIds.end())
+	{
+		return it->second;
+	}
+	auto id = (uint32_t)stringIds.size();
+	stringIds.emplace(str, id);
+	return id;
+}
+
+uint32_t Classifier::newPropertyVersion() noexcept
+{
+	static uint32_t version = 0;
+	version++;
+	if (version == 0)
+	{
+		version++;
+	}
+	return version;
+}
 
 Variable Classifier::get(const Queryable& obj, uint16_t skipFirst) const
 {
-	Variable returnVar;
-	bool hasResult = false;
-	for (const auto& classVal : classifierValues)
+	auto version = obj.PropertyVersion();
+	if (version == 0)
+	{
+		return eval(obj, skipFirst);
+	}
+	auto& cached = cache[(((uintptr_t)&obj >> 4) + skipFirst) % CacheSize];
+	if (cached.obj != &obj ||
+		cached.version != version ||
+		cached.skipFirst != skipFirst)
+	{
+		cached.value = eval(obj, skipFirst);
+		cached.obj = &obj;
+		cached.version = version;
+		cached.skipFirst = skipFirst;
+	}
+	return cached.value;
+}
+
+Variable Classifier::eval(const Queryable& obj, uint16_t skipFirst) const
+{
+	for (const auto& prop : properties)
 	{
-		bool hasValue = false;
 		Variable value;
-		if (classVal.property.empty() == true)
+		if (prop.name.empty() == false)
 		{
-			hasValue = true;
+			auto propArgs = std::string_view(prop.name).substr(prop.argsOffset);
+			if (obj.getPropertyByHash(prop.name, prop.hash, propArgs, value) == false)
+			{
+				continue;
+			}
 		}
-		else if (obj.getProperty(classVal.property, value) == true)
+
+		// non numeric values compare as 0
+		LevelObjValue intVal = 0;
+		uint32_t stringId = NoStringId;
+		if (std::holds_alternative<int64_t>(value) == true)
 		{
-			hasValue = true;
+			intVal = (LevelObjValue)std::get<int64_t>(value);
 		}
-		if (hasValue == true)
+		else if (std::holds_alternative<bool>(value) == true)
 		{
-			for (const auto& itemElem : classVal.values)
+			intVal = (LevelObjValue)std::get<bool>(value);
+		}
+		else if (std::holds_alternative<std::string>(value) == true)
+		{
+			auto it = stringIds.find(std::get<std::string>(value));
+			if (it != stringIds.end())
 			{
-				bool compareResult = false;
+				stringId = it->second;
+			}
+		}
 
-				if (std::holds_alternative<ClassifierValue::ValuePair>(itemElem.compare) == true)
-				{
-					const auto& minMax = std::get<ClassifierValue::ValuePair>(itemElem.compare);
-					LevelObjValue intVal = 0;
-					if (std::holds_alternative<int64_t>(value) == true)
-					{
-						intVal = (LevelObjValue)std::get<int64_t>(value);
-					}
-					else if (std::holds_alternative<bool>(value) == true)
-					{
-						intVal = (LevelObjValue)std::get<bool>(value);
-					}
-					if (intVal >= minMax.first && intVal <= minMax.second)
-					{
-						compareResult = true;
-					}
-				}
-				else
-				{
-					const auto& str = std::get<std::string>(value);
-					if (std::holds_alternative<std::string>(itemElem.compare) == true &&
-						std::get<std::string>(itemElem.compare) == str)
-					{
-						compareResult = true;
-					}
-				}
-				if (compareResult == true)
+		auto entryIt = entries.begin() + prop.firstEntry;
+		auto entryEnd = entryIt + prop.numEntries;
+		for (; entryIt != entryEnd; ++entryIt)
+		{
+			bool compareResult = false;
+			if (entryIt->stringId == NoStringId)
+			{
+				compareResult = intVal >= entryIt->min && intVal <= entryIt->max;
+			}
+			else
+			{
+				compareResult = entryIt->stringId == stringId;
+			}
+			if (compareResult == true)
+			{
+				if (skipFirst > 0)
 				{
-					if (skipFirst > 0)
-					{
-						skipFirst--;
-					}
-					else
-					{
-						returnVar = itemElem.value;
-						hasResult = true;
-					}
+					skipFirst--;
 					break;
 				}
-			}
-			if (hasResult == true)
-			{
-				break;
+				return values[entryIt->valueIdx];
 			}
 		}
 	}
-	return returnVar;
+	return {};
 }
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <array>
 #include "Game/Properties/LevelObjValue.h"
 #include "Game/Queryable.h"
 #include <string>
+#include "Utils/UnorderedStringMap.h"
 #include <vector>
 
 struct ClassifierValue
@@ -20,14 +22,59 @@ struct ClassifierValueInterval
 	std::vector<ClassifierValue> values;
 };
 
+// classifier intervals are compiled on creation: property names are split and
+// hashed once, compare values are stored in a flat table and strings are
+// interned and compared by id.
 class Classifier
 {
 private:
-	std::vector<ClassifierValueInterval> classifierValues;
+	static constexpr uint32_t NoStringId = 0xFFFFFFFF;
+	static constexpr size_t CacheSize = 32;
+
+	struct CompareEntry
+	{
+		LevelObjValue min{ 0 };
+		LevelObjValue max{ 0 };
+		// NoStringId for min / max compares
+		uint32_t stringId{ NoStringId };
+		uint32_t valueIdx{ 0 };
+	};
+
+	struct Property
+	{
+		std::string name;
+		size_t argsOffset{ 0 };
+		uint16_t hash{ 0 };
+		uint32_t firstEntry{ 0 };
+		uint32_t numEntries{ 0 };
+	};
+
+	struct CacheEntry
+	{
+		const Queryable* obj{ nullptr };
+		uint32_t version{ 0 };
+		uint16_t skipFirst{ 0 };
+		Variable value;
+	};
+
+	std::vector<Property> properties;
+	std::vector<CompareEntry> entries;
+	std::vector<Variable> values;
+	UnorderedStringMap<uint32_t> stringIds;
+
+	// results per (object, property version, skipFirst).
+	mutable std::array<CacheEntry, CacheSize> cache;
+
+	uint32_t getStringId(const std::string& str);
+
+	Variable eval(const Queryable& obj, uint16_t skipFirst) const;
 
 public:
-	Classifier(std::vector<ClassifierValueInterval> values) noexcept
-		: classifierValues(std::move(values)) {}
+	Classifier(std::vector<ClassifierValueInterval> intervals);
 
 	Variable get(const Queryable& obj, uint16_t skipFirst = 0) const;
+
+	// returns a new property version, unique for the lifetime of the program.
+	// objects call this whenever their properties change.
+	static uint32_t newPropertyVersion() noexcept;
 };
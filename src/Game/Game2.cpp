@@ -1,6 +1,8 @@
 #include "Game2.h"
 #include "Game/Level/Level.h"
 #include "Game/Level/LevelMap.h"
+#include "Game/Player/Player.h"
+#include "Utils/StringHash.h"
 
 bool Game2::getGameProperty(const std::string_view prop1, const std::string_view prop2, Variable& var) const
 {
@@ -25,6 +27,45 @@ void Game2::setGameProperty(const std::string_view prop, const Variable& val)
 	Game::setGameProperty(prop, val);
 }
 
+uint64_t Game2::getStateChecksum() const
+{
+	auto checksum = Game::getStateChecksum();
+	auto level = resourceManager.getCurrentLevel<Level>();
+	if (level == nullptr)
+	{
+		return checksum;
+	}
+	size_t hash = 0;
+	level->LevelObjects().forEach([&hash](const LevelObject& obj)
+	{
+		hashCombine(hash, obj.getId());
+		hashCombine(hash, obj.MapPosition().x);
+		hashCombine(hash, obj.MapPosition().y);
+	});
+	const auto& players = level->LevelObjects().Players();
+	for (size_t i = 0; i < players.size(); i++)
+	{
+		auto player = players.at(i);
+		for (auto propHash : {
+			str2int16("strengthNow"), str2int16("magicNow"), str2int16("dexterityNow"),
+			str2int16("vitalityNow"), str2int16("lifeNow"), str2int16("manaNow"),
+			str2int16("armor"), str2int16("toHit"), str2int16("damageMin"),
+			str2int16("damageMax") })
+		{
+			LevelObjValue value = 0;
+			player->getIntByHash(propHash, value);
+			hashCombine(hash, value);
+		}
+		for (auto propHash : { str2int16("level"), str2int16("experience"), str2int16("points") })
+		{
+			uint32_t value = 0;
+			player->getUIntByHash(propHash, value);
+			hashCombine(hash, value);
+		}
+	}
+	return checksum ^ hash;
+}
+
 bool Game2::getQueryableList(const std::string_view prop1, const std::string_view prop2,
 	std::vector<VarOrQueryObject>& queryableList) const
 {
@@ -9,6 +9,9 @@ public:
 
 	void setGameProperty(const std::string_view prop, const Variable& val) override;
 
+	// adds the current level's object positions and player stats.
+	uint64_t getStateChecksum() const override;
+
 	bool getQueryableList(const std::string_view prop1, const std::string_view prop2,
 		std::vector<VarOrQueryObject>& queryableList) const override;
 };
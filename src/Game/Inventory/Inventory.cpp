@@ -1,4 +1,6 @@
 #include "Inventory.h"
+#include <algorithm>
+#include <bit>
 #include "Game/GameHashes.h"
 #include "Game/Utils/UIObjectUtils.h"
 #include "Utils/Utils.h"
@@ -19,6 +21,7 @@ void Inventory::init(size_t size_)
 	size = PairUInt8(newSize, 1);
 	items.resize(newSize);
 	resetIndexes();
+	rebuildIndexes();
 }
 
 void Inventory::init(const PairUInt8& size_)
@@ -34,6 +37,7 @@ void Inventory::init(const PairUInt8& size_)
 	}
 	items.resize(size.x * size.y);
 	resetIndexes();
+	rebuildIndexes();
 }
 
 void Inventory::resetIndexes() noexcept
@@ -44,12 +48,78 @@ void Inventory::resetIndexes() noexcept
 	}
 }
 
+void Inventory::rebuildIndexes()
+{
+	rowWords = ((size_t)size.x + 63) / 64;
+	occupancy.assign(rowWords * size.y, 0);
+	classSlots.clear();
+	for (size_t i = 0; i < items.size(); i++)
+	{
+		if (items[i].first != nullptr)
+		{
+			addToClassSlots(i);
+		}
+		updateOccupancy(i);
+	}
+}
+
+void Inventory::updateOccupancy(size_t idx) noexcept
+{
+	auto x = idx % size.x;
+	auto y = idx / size.x;
+	auto& word = occupancy[y * rowWords + x / 64];
+	auto bit = (uint64_t)1 << (x % 64);
+	if (isCellUsed(idx) == true)
+	{
+		word |= bit;
+	}
+	else
+	{
+		word &= ~bit;
+	}
+}
+
+void Inventory::addToClassSlots(size_t idx)
+{
+	auto& slots = classSlots[items[idx].first->Class()->IdHash16()];
+	slots.insert(std::lower_bound(slots.begin(), slots.end(), idx), (uint16_t)idx);
+}
+
+void Inventory::removeFromClassSlots(size_t idx)
+{
+	auto it = classSlots.find(items[idx].first->Class()->IdHash16());
+	if (it == classSlots.end())
+	{
+		return;
+	}
+	auto& slots = it->second;
+	auto slot = std::lower_bound(slots.begin(), slots.end(), idx);
+	if (slot != slots.end() && *slot == idx)
+	{
+		slots.erase(slot);
+	}
+}
+
+void Inventory::setItemCell(size_t idx, std::shared_ptr<Item>&& item, int32_t itemIdx)
+{
+	if (items[idx].first != nullptr)
+	{
+		removeFromClassSlots(idx);
+	}
+	items[idx].first = std::move(item);
+	items[idx].second = itemIdx;
+	if (items[idx].first != nullptr)
+	{
+		addToClassSlots(idx);
+	}
+	updateOccupancy(idx);
+}
+
 bool Inventory::empty() const noexcept
 {
-	for (const auto& item : items)
+	for (auto word : occupancy)
 	{
-		if (item.first != nullptr ||
-			item.second >= 0)
+		if (word != 0)
 		{
 			return false;
 		}
@@ -169,13 +239,16 @@ bool Inventory::setAndDontEnforceItemSize(size_t idx, std::shared_ptr<Item>& ite
 		item->clearMapPosition();
 		itemCount++;
 	}
+	if (items[idx].first != nullptr)
+	{
+		removeFromClassSlots(idx);
+	}
 	oldItem = std::move(items[idx].first);
 	if (oldItem != nullptr)
 	{
 		itemCount--;
 	}
-	items[idx].first = std::move(item);
-	items[idx].second = -1;
+	setItemCell(idx, std::move(item));
 
 	LevelObjValue transferedQuantity;
 	if (updateQuantities(itemPtr, oldItem.get(), transferedQuantity) == true)
@@ -245,13 +318,16 @@ bool Inventory::setAndEnforceItemSize(const PairUInt8& position, std::shared_ptr
 				if (items[i].second == oldIdx)
 				{
 					items[i].second = -1;
+					updateOccupancy(i);
 				}
 				continue;
 			}
 			if (items[i].first.get() == oldItemPtr)
 			{
 				oldIdx = (int32_t)i;
+				removeFromClassSlots(i);
 				oldItem = std::move(items[i].first);
+				updateOccupancy(i);
 			}
 		}
 	}
@@ -269,14 +345,14 @@ bool Inventory::setAndEnforceItemSize(const PairUInt8& position, std::shared_ptr
 			if (newIdx >= 0)
 			{
 				items[idx].second = newIdx;
+				updateOccupancy(idx);
 				continue;
 			}
 			if (item != nullptr)
 			{
 				item->clearMapPosition();
 			}
-			items[idx].first = std::move(item);
-			items[idx].second = -1;
+			setItemCell(idx, std::move(item));
 			newIdx = (int32_t)idx;
 		}
 	}
@@ -299,15 +375,7 @@ bool Inventory::setAndEnforceItemSize(const PairUInt8& position, std::shared_ptr
 
 bool Inventory::isFull() const noexcept
 {
-	for (const auto& item : items)
-	{
-		if (item.first == nullptr &&
-			item.second < 0)
-		{
-			return false;
-		}
-	}
-	return true;
+	return countFreeSlotsNoChecks() == 0;
 }
 
 bool Inventory::isSlotInUse(size_t idx) const
@@ -328,36 +396,67 @@ bool Inventory::isSlotInUse(const PairUInt8& position) const
 	return isSlotInUse(position.x + position.y * size.x);
 }
 
-bool Inventory::isSlotEmpty(int x, int y, const PairUInt8& itemSize, size_t& itemIdx) const
+bool Inventory::isAreaFree(size_t x, size_t y, size_t width, size_t height) const noexcept
 {
-	size_t sizeX = (size_t)x;
-	size_t sizeY = (size_t)y;
-	if (enforceItemSize == true)
-	{
-		sizeX += itemSize.x;
-		sizeY += itemSize.y;
-	}
-	else
+	for (size_t j = y; j < y + height; j++)
 	{
-		sizeX++;
-		sizeY++;
-	}
-	for (size_t i = x; i < sizeX; i++)
-	{
-		for (size_t j = y; j < sizeY; j++)
+		const auto row = &occupancy[j * rowWords];
+		size_t i = x;
+		size_t end = x + width;
+		while (i < end)
 		{
-			size_t idx = i + j * size.x;
-			if (items[idx].first != nullptr ||
-				items[idx].second >= 0)
+			auto bit = i % 64;
+			auto numBits = std::min<size_t>(64 - bit, end - i);
+			auto mask = (numBits == 64 ? ~(uint64_t)0 : (((uint64_t)1 << numBits) - 1)) << bit;
+			if ((row[i / 64] & mask) != 0)
 			{
 				return false;
 			}
+			i += numBits;
 		}
 	}
-	itemIdx = (size_t)(x + y * (int)size.x);
 	return true;
 }
 
+bool Inventory::findFreeColumn(size_t y, size_t maxX, const PairUInt8& area, bool fromRight, size_t& x) const noexcept
+{
+	if (rowWords == 1)
+	{
+		// bits set where all the rows the item spans are free
+		auto freeCells = ~(uint64_t)0;
+		for (size_t j = y; j < y + area.y; j++)
+		{
+			freeCells &= ~occupancy[j];
+		}
+		// bits set where area.x cells (starting at the bit) are free
+		auto origins = freeCells;
+		for (size_t i = 1; i < area.x; i++)
+		{
+			origins &= freeCells >> i;
+		}
+		if (maxX < 63)
+		{
+			origins &= ((uint64_t)1 << (maxX + 1)) - 1;
+		}
+		if (origins == 0)
+		{
+			return false;
+		}
+		x = (fromRight == true ? 63 - std::countl_zero(origins) : std::countr_zero(origins));
+		return true;
+	}
+	for (size_t i = 0; i <= maxX; i++)
+	{
+		auto x2 = (fromRight == true ? maxX - i : i);
+		if (isAreaFree(x2, y, area.x, area.y) == true)
+		{
+			x = x2;
+			return true;
+		}
+	}
+	return false;
+}
+
 bool Inventory::getFreeSlot(const Item& item, size_t& itemIdx, InventoryPosition invPos) const
 {
 	if (isTypeAllowed(item.Class()->TypeHash16()) == false)
@@ -372,68 +471,27 @@ bool Inventory::getFreeSlot(const Item& item, size_t& itemIdx, InventoryPosition
 		return false;
 	}
 
-	int sizeX = (int)size.x - (int)itemSize.x;
-	int sizeY = (int)size.y - (int)itemSize.y;
+	auto maxX = (size_t)(size.x - itemSize.x);
+	auto maxY = (size_t)(size.y - itemSize.y);
 
-	switch (invPos)
-	{
-	default:
-	case InventoryPosition::TopLeft:
-	{
-		for (int y = 0; y <= sizeY; y++)
-		{
-			for (int x = 0; x <= sizeX; x++)
-			{
-				if (isSlotEmpty(x, y, itemSize, itemIdx) == true)
-				{
-					return true;
-				}
-			}
-		}
-		break;
-	}
-	case InventoryPosition::TopRight:
-	{
-		for (int y = 0; y <= sizeY; y++)
-		{
-			for (int x = sizeX; x >= 0; x--)
-			{
-				if (isSlotEmpty(x, y, itemSize, itemIdx) == true)
-				{
-					return true;
-				}
-			}
-		}
-		break;
-	}
-	case InventoryPosition::BottomLeft:
-	{
-		for (int y = sizeY; y >= 0; y--)
-		{
-			for (int x = 0; x <= sizeX; x++)
-			{
-				if (isSlotEmpty(x, y, itemSize, itemIdx) == true)
-				{
-					return true;
-				}
-			}
-		}
-		break;
-	}
-	case InventoryPosition::BottomRight:
+	// if the item size isn't enforced, items only use one cell
+	// (but are still placed where they would fit)
+	auto area = (enforceItemSize == true ? itemSize : PairUInt8(1, 1));
+
+	bool fromBottom = invPos == InventoryPosition::BottomLeft ||
+		invPos == InventoryPosition::BottomRight;
+	bool fromRight = invPos == InventoryPosition::TopRight ||
+		invPos == InventoryPosition::BottomRight;
+
+	for (size_t i = 0; i <= maxY; i++)
 	{
-		for (int y = sizeY; y >= 0; y--)
+		auto y = (fromBottom == true ? maxY - i : i);
+		size_t x;
+		if (findFreeColumn(y, maxX, area, fromRight, x) == true)
 		{
-			for (int x = sizeX; x >= 0; x--)
-			{
-				if (isSlotEmpty(x, y, itemSize, itemIdx) == true)
-				{
-					return true;
-				}
-			}
+			itemIdx = x + y * size.x;
+			return true;
 		}
-		break;
-	}
 	}
 	return false;
 }
@@ -446,14 +504,8 @@ bool Inventory::hasFreeSlot(const Item& item) const
 
 bool Inventory::hasItem(uint16_t classIdHash16) const
 {
-	for (const auto& item : (*this))
-	{
-		if (item.Class()->IdHash16() == classIdHash16)
-		{
-			return true;
-		}
-	}
-	return false;
+	auto it = classSlots.find(classIdHash16);
+	return it != classSlots.end() && it->second.empty() == false;
 }
 
 bool Inventory::findByClass(uint16_t classIdHash16, size_t& idx, Item*& item) const
@@ -461,16 +513,15 @@ bool Inventory::findByClass(uint16_t classIdHash16, size_t& idx, Item*& item) co
 	auto size = items.size();
 	if (idx < size)
 	{
-		for (size_t i = idx; i < size; i++)
+		auto it = classSlots.find(classIdHash16);
+		if (it != classSlots.end())
 		{
-			if (isSlotInUse(i) == true)
+			auto slot = std::lower_bound(it->second.begin(), it->second.end(), idx);
+			if (slot != it->second.end())
 			{
-				if (items[i].first->Class()->IdHash16() == classIdHash16)
-				{
-					idx = i;
-					item = items[i].first.get();
-					return true;
-				}
+				idx = *slot;
+				item = items[idx].first.get();
+				return true;
 			}
 		}
 	}
@@ -483,22 +534,21 @@ uint32_t Inventory::findFreeQuantity(uint16_t classIdHash16, size_t& idx, Item*&
 	auto size = items.size();
 	if (idx < size)
 	{
-		for (size_t i = idx; i < size; i++)
+		auto it = classSlots.find(classIdHash16);
+		if (it != classSlots.end())
 		{
-			if (isSlotInUse(i) == true)
+			const auto& slots = it->second;
+			for (auto slot = std::lower_bound(slots.begin(), slots.end(), idx); slot != slots.end(); ++slot)
 			{
-				if (items[i].first->Class()->IdHash16() == classIdHash16)
+				auto itemPtr = items[*slot].first.get();
+				auto itemQuantity = itemPtr->getIntByHash(ItemProp::Quantity);
+				auto itemCapacity = itemPtr->getIntByHash(ItemProp::Capacity);
+				if (itemQuantity < itemCapacity &&
+					itemCapacity > 0)
 				{
-					auto itemPtr = items[i].first.get();
-					auto itemQuantity = itemPtr->getIntByHash(ItemProp::Quantity);
-					auto itemCapacity = itemPtr->getIntByHash(ItemProp::Capacity);
-					if (itemQuantity < itemCapacity &&
-						itemCapacity > 0)
-					{
-						idx = i;
-						itemFound = itemPtr;
-						return (uint32_t)(itemCapacity - itemQuantity);
-					}
+					idx = *slot;
+					itemFound = itemPtr;
+					return (uint32_t)(itemCapacity - itemQuantity);
 				}
 			}
 		}
@@ -559,15 +609,12 @@ uint32_t Inventory::findSmallestFreeQuantity(uint16_t classIdHash16, Item*& item
 
 unsigned Inventory::countFreeSlotsNoChecks() const
 {
-	unsigned count = 0;
-	for (const auto& item : items)
+	size_t usedCount = 0;
+	for (auto word : occupancy)
 	{
-		if (item.first == nullptr && item.second < 0)
-		{
-			count++;
-		}
+		usedCount += std::popcount(word);
 	}
-	return count;
+	return (unsigned)(items.size() - usedCount);
 }
 
 unsigned Inventory::countFreeSlots(uint16_t typeHash16) const
@@ -684,12 +731,13 @@ bool Inventory::getQuantity(uint16_t classIdHash16, uint32_t& quantity) const
 	int64_t totalQuantity = 0;
 	if (isTypeAllowed(classIdHash16) == true)
 	{
-		for (const auto& item : (*this))
+		auto it = classSlots.find(classIdHash16);
+		if (it != classSlots.end())
 		{
-			LevelObjValue quant;
-			if (item.Class()->IdHash16() == classIdHash16)
+			for (auto slot : it->second)
 			{
-				if (item.getIntByHash(ItemProp::Quantity, quant) == true)
+				LevelObjValue quant;
+				if (items[slot].first->getIntByHash(ItemProp::Quantity, quant) == true)
 				{
 					totalQuantity += quant;
 					isQuantifiable = true;
@@ -6,6 +6,7 @@
 #include <memory>
 #include "Utils/iterator_tpl.h"
 #include "Utils/PairXY.h"
+#include <unordered_map>
 #include <vector>
 
 class Inventory
@@ -20,6 +21,29 @@ private:
 	std::vector<uint16_t> allowedTypes;
 	bool enforceItemSize{ false };
 
+	// one bit per cell (set if the cell has an item or points to one). rowWords per row.
+	std::vector<uint64_t> occupancy;
+	size_t rowWords{ 0 };
+
+	// sorted slot indexes of the items of each item class id.
+	std::unordered_map<uint16_t, std::vector<uint16_t>> classSlots;
+
+	bool isCellUsed(size_t idx) const noexcept
+	{
+		return items[idx].first != nullptr || items[idx].second >= 0;
+	}
+
+	// updates the occupancy bit of a cell after it changes.
+	void updateOccupancy(size_t idx) noexcept;
+
+	void addToClassSlots(size_t idx);
+	void removeFromClassSlots(size_t idx);
+
+	// sets/moves the item in a slot, keeping the class index updated.
+	void setItemCell(size_t idx, std::shared_ptr<Item>&& item, int32_t itemIdx = -1);
+
+	void rebuildIndexes();
+
 	// Doesn't perform the check for allowed class types. only for items whose size is 1
 	unsigned countFreeSlotsNoChecks() const;
 
@@ -27,7 +51,10 @@ private:
 
 	bool setAndEnforceItemSize(const PairUInt8& position, std::shared_ptr<Item>& item, std::shared_ptr<Item>& oldItem);
 
-	bool isSlotEmpty(int x, int y, const PairUInt8& itemSize, size_t& itemIdx) const;
+	bool isAreaFree(size_t x, size_t y, size_t width, size_t height) const noexcept;
+
+	// finds the first/last x <= maxX in row y where width x height cells are free.
+	bool findFreeColumn(size_t y, size_t maxX, const PairUInt8& area, bool fromRight, size_t& x) const noexcept;
 
 	void resetIndexes() noexcept;
 
@@ -9,7 +9,7 @@
 #include "ItemSave.h"
 #include "Utils/Utils.h"
 
-Item::Item(const ItemClass* class__) : LevelObject(class__)
+Item::Item(const ItemClass* class__) : LevelObject(class__, ObjectType)
 {
 	animation.setTexturePack(class__->getDropTexturePack());
 	animation.textureIndexRange = class__->getDropTextureIndexRange();
@@ -67,6 +67,12 @@ bool Item::getNumber(const std::string_view prop, Number32& value) const
 	return ItemLevelObject::getNumber(*this, prop, value);
 }
 
+void Item::updateFrame(sf::Time elapsedTime, const LevelMap& map)
+{
+	frameUpdated = hasValidState() == true && animation.update(elapsedTime) == true;
+	frameStepped = true;
+}
+
 void Item::update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr)
 {
 	ItemLevelObject::update(*this, game, level, thisPtr);
@@ -77,6 +83,12 @@ bool Item::getProperty(const std::string_view prop, Variable& var) const
 	return ItemLevelObject::getProperty(*this, prop, var);
 }
 
+bool Item::getPropertyByHash(const std::string_view prop, uint16_t propHash,
+	const std::string_view propArgs, Variable& var) const
+{
+	return ItemLevelObject::getPropertyByHash(*this, propHash, propArgs, var);
+}
+
 bool Item::getNumberByHash(const Queryable& owner, uint16_t propHash, LevelObjValue& value) const
 {
 	return ItemLevelObject::getNumberByHash(*this, owner, propHash, value);
@@ -282,7 +294,7 @@ bool Item::use(Player& player, const Level& level, uint32_t& quantityLeft)
 			setIntByHash(ItemProp::Quantity, itemQuantity);
 			quantityLeft = (uint32_t)itemQuantity;
 		}
-		player.updateProperties();
+		player.updateProperties(PlayerInputs::Items);
 	}
 	return ret;
 }
@@ -334,6 +346,7 @@ LevelObjValue Item::addQuantity(LevelObjValue& amount)
 void Item::updateOwner(Queryable* obj)
 {
 	itemOwner = obj;
+	propertyVersion = Classifier::newPropertyVersion();
 	auto classSpell = getBaseSpell();
 	if (obj != nullptr && classSpell != nullptr)
 	{
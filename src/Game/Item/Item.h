@@ -7,7 +7,7 @@
 
 class Player;
 
-class Item : public LevelObject
+class Item final : public LevelObject
 {
 private:
 	friend class ItemLevelObject;
@@ -19,6 +19,7 @@ private:
 	bool wasHoverEnabledOnItemDrop{ false };
 
 	mutable bool updateClassifierVals{ true };
+	uint32_t propertyVersion{ Classifier::newPropertyVersion() };
 
 	mutable std::string name;
 	mutable std::array<std::string, 5> descriptions;
@@ -61,6 +62,8 @@ public:
 
 	constexpr auto Class() const noexcept { return (const ItemClass*)class_; }
 
+	static constexpr LevelObjectType ObjectType = LevelObjectType::Item;
+
 	bool Passable() const noexcept override { return true; }
 
 	const std::string_view getType() const override { return "item"; }
@@ -74,9 +77,13 @@ public:
 
 	bool getNumber(const std::string_view prop, Number32& value) const override;
 
+	void updateFrame(sf::Time elapsedTime, const LevelMap& map) override;
 	void update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr) override;
 
 	bool getProperty(const std::string_view prop, Variable& var) const override;
+	bool getPropertyByHash(const std::string_view prop, uint16_t propHash,
+		const std::string_view propArgs, Variable& var) const override;
+	uint32_t PropertyVersion() const noexcept override { return propertyVersion; }
 
 	// doesn't check Identified, indestructible or unlimitedCharges
 	bool hasPropertyByHash(uint16_t propHash) const noexcept;
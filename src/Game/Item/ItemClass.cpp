@@ -83,7 +83,7 @@ LevelObjValue ItemClass::getClassifierNumOrFormula(size_t idx, const Queryable&
 	{
 		if (std::holds_alternative<std::string>(var) == true)
 		{
-			Formula f(std::get<std::string>(var));
+			Formula f(std::get<std::string>(var), RandomStream::Loot);
 			return (LevelObjValue)f.eval(item);
 		}
 		else if (std::holds_alternative<int64_t>(var) == true)
@@ -190,7 +190,7 @@ void ItemClass::setFormula(uint16_t nameHash, const std::string_view formula)
 	{
 		return;
 	}
-	formulas.setValue(nameHash, formula);
+	formulas.setValue(nameHash, Formula(formula, RandomStream::Loot));
 }
 
 void ItemClass::deleteFormula(uint16_t nameHash)
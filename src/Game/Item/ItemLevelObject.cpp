@@ -1,4 +1,5 @@
 #include "ItemLevelObject.h"
+#include "Game/Formula.h"
 #include "Game/Game.h"
 #include "Game/GameHashes.h"
 #include "Game/Level/Level.h"
@@ -61,6 +62,7 @@ bool ItemLevelObject::setIntByHash(Item& item, uint16_t propHash, LevelObjValue
 	}
 	}
 	item.updateClassifierVals = true;
+	item.propertyVersion = Classifier::newPropertyVersion();
 	return true;
 }
 
@@ -155,6 +157,7 @@ void ItemLevelObject::updateClassifierValues(const Item& item)
 	{
 		item.updateClassifierVals = false;
 		updatePrice(item);
+		Formula::CosmeticScope cosmeticScope;
 		if (item.identified == false)
 		{
 			item.name = item.SimpleName();
@@ -180,8 +183,13 @@ bool ItemLevelObject::getProperty(const Item& item, const std::string_view prop,
 		return false;
 	}
 	auto props = Utils::splitStringIn2(prop, '.');
-	auto propHash = str2int16(props.first);
-	if (item.getLevelObjProp(propHash, props.second, var) == true)
+	return getPropertyByHash(item, str2int16(props.first), props.second, var);
+}
+
+bool ItemLevelObject::getPropertyByHash(const Item& item, uint16_t propHash,
+	const std::string_view propArgs, Variable& var)
+{
+	if (item.getLevelObjProp(propHash, propArgs, var) == true)
 	{
 		return true;
 	}
@@ -200,7 +208,7 @@ bool ItemLevelObject::getProperty(const Item& item, const std::string_view prop,
 	case str2int16("d"):
 	case str2int16("description"):
 	{
-		size_t idx = Utils::strtou(props.second);
+		size_t idx = Utils::strtou(propArgs);
 		if (idx >= item.descriptions.size())
 		{
 			idx = 0;
@@ -209,27 +217,27 @@ bool ItemLevelObject::getProperty(const Item& item, const std::string_view prop,
 		break;
 	}
 	case str2int16("eval"):
-		var = Variable((int64_t)Formula::evalString(props.second, &item, item.itemOwner));
+		var = Variable((int64_t)Formula::evalString(propArgs, &item, item.itemOwner));
 		break;
 	case str2int16("evalMin"):
-		var = Variable((int64_t)Formula::evalMinString(props.second, &item, item.itemOwner));
+		var = Variable((int64_t)Formula::evalMinString(propArgs, &item, item.itemOwner));
 		break;
 	case str2int16("evalMax"):
-		var = Variable((int64_t)Formula::evalMaxString(props.second, &item, item.itemOwner));
+		var = Variable((int64_t)Formula::evalMaxString(propArgs, &item, item.itemOwner));
 		break;
 	case str2int16("evalf"):
-		var = Variable(Formula::evalString(props.second, &item, item.itemOwner));
+		var = Variable(Formula::evalString(propArgs, &item, item.itemOwner));
 		break;
 	case str2int16("evalMinf"):
-		var = Variable(Formula::evalMinString(props.second, &item, item.itemOwner));
+		var = Variable(Formula::evalMinString(propArgs, &item, item.itemOwner));
 		break;
 	case str2int16("evalMaxf"):
-		var = Variable(Formula::evalMaxString(props.second, &item, item.itemOwner));
+		var = Variable(Formula::evalMaxString(propArgs, &item, item.itemOwner));
 		break;
 	case str2int16("hasDescription"):
 	{
 		bool hasDescr = false;
-		size_t idx = Utils::strtou(props.second);
+		size_t idx = Utils::strtou(propArgs);
 		if (idx < item.descriptions.size())
 		{
 			hasDescr = item.descriptions[idx].empty() == false;
@@ -244,7 +252,7 @@ bool ItemLevelObject::getProperty(const Item& item, const std::string_view prop,
 		var = Variable(item.identified);
 		break;
 	case str2int16("inventorySize"):
-		var = UIObjectUtils::getTuple2iProp(item.Class()->InventorySize(), props.second);
+		var = UIObjectUtils::getTuple2iProp(item.Class()->InventorySize(), propArgs);
 		break;
 	case str2int16("itemType"):
 		var = Variable(item.ItemType());
@@ -277,14 +285,14 @@ bool ItemLevelObject::getProperty(const Item& item, const std::string_view prop,
 		var = Variable((int64_t)item.properties.size());
 		break;
 	case str2int16("hasProperty"):
-		var = Variable(item.properties.hasValue(str2int16(props.second)));
+		var = Variable(item.properties.hasValue(str2int16(propArgs)));
 		break;
 	case str2int16("baseSpell"):
 	{
 		auto spelli = item.getBaseSpell();
 		if (spelli != nullptr)
 		{
-			return spelli->getProperty(props.second, var);
+			return spelli->getProperty(propArgs, var);
 		}
 		return false;
 	}
@@ -292,7 +300,7 @@ bool ItemLevelObject::getProperty(const Item& item, const std::string_view prop,
 	{
 		if (item.spell != nullptr)
 		{
-			return item.spell->getProperty(props.second, var);
+			return item.spell->getProperty(propArgs, var);
 		}
 		return false;
 	}
@@ -304,7 +312,7 @@ bool ItemLevelObject::getProperty(const Item& item, const std::string_view prop,
 			var = Variable((int64_t)value);
 			break;
 		}
-		else if (item.Class()->evalFormula(propHash, item, item, value, props.second) == true)
+		else if (item.Class()->evalFormula(propHash, item, item, value, propArgs) == true)
 		{
 			var = Variable((int64_t)value);
 			break;
@@ -323,9 +331,14 @@ void ItemLevelObject::update(Item& item, Game& game, Level& level, const std::sh
 	item.processQueuedActions(game);
 	item.updateHover(game, level, thisPtr);
 
-	if (item.hasValidState() == true &&
-		item.animation.update(game.getElapsedTime()) == true)
+	if (item.frameStepped == false)
+	{
+		item.updateFrame(game.getElapsedTime(), level.Map());
+	}
+	item.frameStepped = false;
+	if (item.frameUpdated == true)
 	{
+		item.frameUpdated = false;
 		if (item.wasHoverEnabledOnItemDrop == true)
 		{
 			item.enableHover = true;
@@ -39,5 +39,8 @@ public:
 
 	static bool getProperty(const Item& item, const std::string_view prop, Variable& var);
 
+	static bool getPropertyByHash(const Item& item, uint16_t propHash,
+		const std::string_view propArgs, Variable& var);
+
 	static void update(Item& item, Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr);
 };
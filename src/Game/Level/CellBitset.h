@@ -0,0 +1,127 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include "Utils/PairXY.h"
+#include <vector>
+
+// one bit per map cell.
+class CellBitset
+{
+private:
+	std::vector<uint64_t> bits;
+	PairInt32 size;
+
+	size_t getIndex(const PairInt32& pos) const noexcept { return (size_t)pos.x + (size_t)pos.y * (size_t)size.x; }
+
+	bool isValid(const PairInt32& pos) const noexcept
+	{
+		return pos.x >= 0 && pos.x < size.x && pos.y >= 0 && pos.y < size.y;
+	}
+
+public:
+	// resizes and clears all bits.
+	void resize(const PairInt32& size_)
+	{
+		size = size_;
+		bits.assign(((size_t)size.x * (size_t)size.y + 63) / 64, 0);
+	}
+
+	void clear() noexcept { std::fill(bits.begin(), bits.end(), 0); }
+
+	auto& Size() const noexcept { return size; }
+
+	bool get(const PairInt32& pos) const noexcept
+	{
+		if (isValid(pos) == false)
+		{
+			return false;
+		}
+		auto idx = getIndex(pos);
+		return (bits[idx / 64] & (1ull << (idx % 64))) != 0;
+	}
+
+	// returns true if the bit wasn't set.
+	bool set(const PairInt32& pos) noexcept
+	{
+		if (isValid(pos) == false)
+		{
+			return false;
+		}
+		auto idx = getIndex(pos);
+		auto& word = bits[idx / 64];
+		auto mask = 1ull << (idx % 64);
+		if ((word & mask) != 0)
+		{
+			return false;
+		}
+		word |= mask;
+		return true;
+	}
+
+	void reset(const PairInt32& pos) noexcept
+	{
+		if (isValid(pos) == true)
+		{
+			auto idx = getIndex(pos);
+			bits[idx / 64] &= ~(1ull << (idx % 64));
+		}
+	}
+
+	size_t count() const noexcept
+	{
+		size_t num = 0;
+		for (auto word : bits)
+		{
+			num += (size_t)std::popcount(word);
+		}
+		return num;
+	}
+
+	// lengths of the alternating runs of unset and set bits, starting with unset bits.
+	std::vector<uint32_t> getRuns() const
+	{
+		std::vector<uint32_t> runs;
+		auto numBits = (size_t)size.x * (size_t)size.y;
+		bool value = false;
+		uint32_t run = 0;
+		for (size_t i = 0; i < numBits; i++)
+		{
+			bool bit = (bits[i / 64] & (1ull << (i % 64))) != 0;
+			if (bit != value)
+			{
+				runs.push_back(run);
+				value = bit;
+				run = 0;
+			}
+			run++;
+		}
+		if (value == true)
+		{
+			runs.push_back(run);
+		}
+		return runs;
+	}
+
+	void setRuns(const std::vector<uint32_t>& runs) noexcept
+	{
+		clear();
+		auto numBits = (size_t)size.x * (size_t)size.y;
+		size_t i = 0;
+		bool value = false;
+		for (auto run : runs)
+		{
+			auto end = std::min(i + run, numBits);
+			if (value == true)
+			{
+				for (; i < end; i++)
+				{
+					bits[i / 64] |= 1ull << (i % 64);
+				}
+			}
+			i = end;
+			value = !value;
+		}
+	}
+};
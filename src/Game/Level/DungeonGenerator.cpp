@@ -0,0 +1,387 @@
+#include "DungeonGenerator.h"
+#include <algorithm>
+
+namespace
+{
+	struct Room
+	{
+		int32_t x{ 0 };
+		int32_t y{ 0 };
+		int32_t width{ 0 };
+		int32_t height{ 0 };
+
+		PairInt32 center() const noexcept { return PairInt32(x + width / 2, y + height / 2); }
+
+		// true if the rooms are closer than margin cells.
+		bool intersects(const Room& room, int32_t margin) const noexcept
+		{
+			return x - margin < room.x + room.width &&
+				room.x - margin < x + width &&
+				y - margin < room.y + room.height &&
+				room.y - margin < y + height;
+		}
+	};
+
+	// uniform number in [min, max]
+	int32_t getRandom(PCG32& rng, int32_t min, int32_t max) noexcept
+	{
+		if (max <= min)
+		{
+			return min;
+		}
+		return min + (int32_t)(rng() % (uint32_t)(max - min + 1));
+	}
+
+	int32_t getRandomTile(PCG32& rng, const std::vector<int32_t>& tiles, int32_t defaultTile) noexcept
+	{
+		if (tiles.empty() == true)
+		{
+			return defaultTile;
+		}
+		return tiles[rng() % (uint32_t)tiles.size()];
+	}
+
+	bool isOpen(DungeonCell cell) noexcept
+	{
+		return cell == DungeonCell::Floor || cell == DungeonCell::Door;
+	}
+}
+
+DungeonLayout DungeonGenerator::generate(const DungeonParams& params)
+{
+	DungeonLayout layout;
+	layout.size.x = std::max(params.size.x, 0);
+	layout.size.y = std::max(params.size.y, 0);
+	layout.cells.assign((size_t)layout.size.x * (size_t)layout.size.y, DungeonCell::Empty);
+
+	PCG32 rng(params.seed);
+	switch (params.type)
+	{
+	default:
+	case DungeonType::Rooms:
+		generateRooms(layout, params, rng);
+		break;
+	case DungeonType::Caves:
+		generateCaves(layout, params, rng);
+		break;
+	}
+	addWalls(layout);
+	return layout;
+}
+
+void DungeonGenerator::generateRooms(DungeonLayout& layout, const DungeonParams& params, PCG32& rng)
+{
+	const auto& size = layout.size;
+	auto minRoomSize = std::max(params.roomSize.x, 1);
+	auto maxRoomSize = std::min(std::max(params.roomSize.y, minRoomSize), std::min(size.x, size.y) - 2);
+	if (maxRoomSize < minRoomSize)
+	{
+		return;
+	}
+
+	// rooms keep 2 cells apart, so each has its own walls.
+	std::vector<Room> rooms;
+	auto numRooms = getRandom(rng, params.numRooms.x, params.numRooms.y);
+	for (int32_t i = 0; i < numRooms * 8 && (int32_t)rooms.size() < numRooms; i++)
+	{
+		Room room;
+		room.width = getRandom(rng, minRoomSize, maxRoomSize);
+		room.height = getRandom(rng, minRoomSize, maxRoomSize);
+		room.x = getRandom(rng, 1, size.x - room.width - 1);
+		room.y = getRandom(rng, 1, size.y - room.height - 1);
+		bool intersects = false;
+		for (const auto& other : rooms)
+		{
+			if (room.intersects(other, 2) == true)
+			{
+				intersects = true;
+				break;
+			}
+		}
+		if (intersects == false)
+		{
+			rooms.push_back(room);
+		}
+	}
+	for (const auto& room : rooms)
+	{
+		for (int32_t y = room.y; y < room.y + room.height; y++)
+		{
+			std::fill_n(layout.cells.begin() + (y * size.x + room.x), room.width, DungeonCell::Floor);
+		}
+	}
+
+	// L shaped corridors from each room to the previous one.
+	std::vector<bool> corridors(layout.cells.size());
+	auto carve = [&](int32_t x, int32_t y)
+	{
+		auto idx = (size_t)(x + y * size.x);
+		if (layout.cells[idx] == DungeonCell::Empty)
+		{
+			layout.cells[idx] = DungeonCell::Floor;
+			corridors[idx] = true;
+		}
+	};
+	for (size_t i = 1; i < rooms.size(); i++)
+	{
+		auto a = rooms[i - 1].center();
+		auto b = rooms[i].center();
+		bool horizontalFirst = (rng() & 1) != 0;
+		PairInt32 corner = horizontalFirst ? PairInt32(b.x, a.y) : PairInt32(a.x, b.y);
+		for (int32_t x = std::min(a.x, b.x); x <= std::max(a.x, b.x); x++)
+		{
+			carve(x, horizontalFirst ? a.y : b.y);
+		}
+		for (int32_t y = std::min(a.y, b.y); y <= std::max(a.y, b.y); y++)
+		{
+			carve(corner.x, y);
+		}
+	}
+
+	// doors where a corridor goes through the walls of a room.
+	auto isCorridor = [&](int32_t x, int32_t y)
+	{
+		return x >= 0 && x < size.x && y >= 0 && y < size.y &&
+			corridors[(size_t)(x + y * size.x)] == true;
+	};
+	for (const auto& room : rooms)
+	{
+		for (int32_t x = room.x; x < room.x + room.width; x++)
+		{
+			for (auto y : { room.y - 1, room.y + room.height })
+			{
+				if (isCorridor(x, y) == true &&
+					isOpen(layout.get(x - 1, y)) == false &&
+					isOpen(layout.get(x + 1, y)) == false)
+				{
+					layout.cells[(size_t)(x + y * size.x)] = DungeonCell::Door;
+				}
+			}
+		}
+		for (int32_t y = room.y; y < room.y + room.height; y++)
+		{
+			for (auto x : { room.x - 1, room.x + room.width })
+			{
+				if (isCorridor(x, y) == true &&
+					isOpen(layout.get(x, y - 1)) == false &&
+					isOpen(layout.get(x, y + 1)) == false)
+				{
+					layout.cells[(size_t)(x + y * size.x)] = DungeonCell::Door;
+				}
+			}
+		}
+	}
+}
+
+void DungeonGenerator::generateCaves(DungeonLayout& layout, const DungeonParams& params, PCG32& rng)
+{
+	const auto& size = layout.size;
+	if (size.x < 3 || size.y < 3)
+	{
+		return;
+	}
+
+	// random fill, with a solid border.
+	for (int32_t y = 1; y < size.y - 1; y++)
+	{
+		for (int32_t x = 1; x < size.x - 1; x++)
+		{
+			if ((int32_t)(rng() % 100) >= params.fill)
+			{
+				layout.cells[(size_t)(x + y * size.x)] = DungeonCell::Floor;
+			}
+		}
+	}
+
+	// smoothing. a cell becomes solid if most of its neighbours are.
+	auto cells = layout.cells;
+	for (int32_t i = 0; i < params.iterations; i++)
+	{
+		for (int32_t y = 1; y < size.y - 1; y++)
+		{
+			for (int32_t x = 1; x < size.x - 1; x++)
+			{
+				int32_t numSolid = 0;
+				for (int32_t j = -1; j <= 1; j++)
+				{
+					for (int32_t k = -1; k <= 1; k++)
+					{
+						if ((j != 0 || k != 0) &&
+							layout.cells[(size_t)(x + k + (y + j) * size.x)] == DungeonCell::Empty)
+						{
+							numSolid++;
+						}
+					}
+				}
+				auto idx = (size_t)(x + y * size.x);
+				bool solid = numSolid >= 5 ||
+					(numSolid == 4 && layout.cells[idx] == DungeonCell::Empty);
+				cells[idx] = solid == true ? DungeonCell::Empty : DungeonCell::Floor;
+			}
+		}
+		layout.cells.swap(cells);
+	}
+
+	// only keep the largest open region, so the whole cave is connected.
+	std::vector<int32_t> regions(layout.cells.size(), -1);
+	std::vector<size_t> stack;
+	int32_t largestRegion = -1;
+	size_t largestRegionSize = 0;
+	int32_t numRegions = 0;
+	for (size_t start = 0; start < layout.cells.size(); start++)
+	{
+		if (layout.cells[start] != DungeonCell::Floor ||
+			regions[start] >= 0)
+		{
+			continue;
+		}
+		size_t regionSize = 0;
+		regions[start] = numRegions;
+		stack.push_back(start);
+		while (stack.empty() == false)
+		{
+			auto idx = stack.back();
+			stack.pop_back();
+			regionSize++;
+			auto x = (int32_t)(idx % (size_t)size.x);
+			auto y = (int32_t)(idx / (size_t)size.x);
+			for (auto next : { PairInt32(x - 1, y), PairInt32(x + 1, y), PairInt32(x, y - 1), PairInt32(x, y + 1) })
+			{
+				if (layout.get(next.x, next.y) != DungeonCell::Floor)
+				{
+					continue;
+				}
+				auto nextIdx = (size_t)(next.x + next.y * size.x);
+				if (regions[nextIdx] < 0)
+				{
+					regions[nextIdx] = numRegions;
+					stack.push_back(nextIdx);
+				}
+			}
+		}
+		if (regionSize > largestRegionSize)
+		{
+			largestRegion = numRegions;
+			largestRegionSize = regionSize;
+		}
+		numRegions++;
+	}
+	for (size_t i = 0; i < layout.cells.size(); i++)
+	{
+		if (layout.cells[i] == DungeonCell::Floor &&
+			regions[i] != largestRegion)
+		{
+			layout.cells[i] = DungeonCell::Empty;
+		}
+	}
+}
+
+void DungeonGenerator::addWalls(DungeonLayout& layout)
+{
+	const auto& size = layout.size;
+	for (int32_t y = 0; y < size.y; y++)
+	{
+		for (int32_t x = 0; x < size.x; x++)
+		{
+			auto& cell = layout.cells[(size_t)(x + y * size.x)];
+			if (cell != DungeonCell::Empty)
+			{
+				continue;
+			}
+			for (int32_t j = -1; j <= 1 && cell == DungeonCell::Empty; j++)
+			{
+				for (int32_t k = -1; k <= 1; k++)
+				{
+					if (isOpen(layout.get(x + k, y + j)) == true)
+					{
+						cell = DungeonCell::Wall;
+						break;
+					}
+				}
+			}
+		}
+	}
+}
+
+Vector2D<int32_t> DungeonGenerator::getTiles(const DungeonLayout& layout, const DungeonTiles& tiles, uint64_t seed)
+{
+	Vector2D<int32_t> vec((size_t)layout.size.x, (size_t)layout.size.y, tiles.empty);
+	PCG32 rng(seed, 1);
+	auto defaultFloor = tiles.floor.empty() == false ? tiles.floor.front() : tiles.empty;
+	auto defaultWall = tiles.wall.empty() == false ? tiles.wall.front() : tiles.empty;
+	for (int32_t y = 0; y < layout.size.y; y++)
+	{
+		for (int32_t x = 0; x < layout.size.x; x++)
+		{
+			int32_t index = tiles.empty;
+			switch (layout.get(x, y))
+			{
+			case DungeonCell::Floor:
+				index = getRandomTile(rng, tiles.floor, tiles.empty);
+				break;
+			case DungeonCell::Wall:
+			{
+				bool wallX = layout.get(x - 1, y) == DungeonCell::Wall &&
+					layout.get(x + 1, y) == DungeonCell::Wall;
+				bool wallY = layout.get(x, y - 1) == DungeonCell::Wall &&
+					layout.get(x, y + 1) == DungeonCell::Wall;
+				if (wallX == true && wallY == false && tiles.wallX.empty() == false)
+				{
+					index = getRandomTile(rng, tiles.wallX, defaultWall);
+				}
+				else if (wallY == true && wallX == false && tiles.wallY.empty() == false)
+				{
+					index = getRandomTile(rng, tiles.wallY, defaultWall);
+				}
+				else
+				{
+					index = getRandomTile(rng, tiles.wall, tiles.empty);
+				}
+				break;
+			}
+			case DungeonCell::Door:
+				index = getRandomTile(rng, tiles.door, defaultFloor);
+				break;
+			default:
+				break;
+			}
+			vec.set((size_t)x, (size_t)y, index);
+		}
+	}
+	return vec;
+}
+
+Vector2D<int32_t> DungeonGenerator::getFlags(const DungeonLayout& layout)
+{
+	Vector2D<int32_t> vec((size_t)layout.size.x, (size_t)layout.size.y, 1);
+	for (int32_t y = 0; y < layout.size.y; y++)
+	{
+		for (int32_t x = 0; x < layout.size.x; x++)
+		{
+			if (isOpen(layout.get(x, y)) == true)
+			{
+				vec.set((size_t)x, (size_t)y, 0);
+			}
+		}
+	}
+	return vec;
+}
+
+uint64_t DungeonGenerator::hash(const Vector2D<int32_t>& tiles) noexcept
+{
+	// FNV-1a
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (size_t y = 0; y < tiles.Height(); y++)
+	{
+		for (size_t x = 0; x < tiles.Width(); x++)
+		{
+			auto val = (uint32_t)tiles[x][y];
+			for (int i = 0; i < 4; i++)
+			{
+				hash ^= (val >> (i * 8)) & 0xFF;
+				hash *= 0x100000001b3ULL;
+			}
+		}
+	}
+	return hash;
+}
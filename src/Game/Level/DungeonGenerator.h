@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include "Utils/PairXY.h"
+#include "Utils/Random.h"
+#include "Utils/Vector2D.h"
+#include <vector>
+
+enum class DungeonType : uint8_t
+{
+	Rooms,
+	Caves
+};
+
+enum class DungeonCell : uint8_t
+{
+	Empty,
+	Floor,
+	Wall,
+	Door
+};
+
+// tile indexes used for each cell type. a random one is used if there's more than one.
+struct DungeonTiles
+{
+	int32_t empty{ -1 };
+	std::vector<int32_t> floor;
+	std::vector<int32_t> wall;
+	// walls in a line along the x or the y axis. wall is used if empty.
+	std::vector<int32_t> wallX;
+	std::vector<int32_t> wallY;
+	// floor is used if empty.
+	std::vector<int32_t> door;
+};
+
+struct DungeonParams
+{
+	DungeonType type{ DungeonType::Rooms };
+	PairInt32 size{ 112, 112 };
+	uint64_t seed{ 0 };
+	// rooms: min/max number of rooms and of room width/height.
+	PairInt32 numRooms{ 8, 16 };
+	PairInt32 roomSize{ 4, 12 };
+	// caves: % of solid cells before smoothing and number of smoothing passes.
+	int32_t fill{ 45 };
+	int32_t iterations{ 5 };
+	DungeonTiles tiles;
+};
+
+struct DungeonLayout
+{
+	PairInt32 size;
+	std::vector<DungeonCell> cells;
+
+	DungeonCell get(int32_t x, int32_t y) const noexcept
+	{
+		if (x < 0 || x >= size.x || y < 0 || y >= size.y)
+		{
+			return DungeonCell::Empty;
+		}
+		return cells[(size_t)(x + y * size.x)];
+	}
+};
+
+// generates rooms and corridors or caves. the same params (and seed) always give the same dungeon.
+class DungeonGenerator
+{
+private:
+	static void generateRooms(DungeonLayout& layout, const DungeonParams& params, PCG32& rng);
+	static void generateCaves(DungeonLayout& layout, const DungeonParams& params, PCG32& rng);
+	static void addWalls(DungeonLayout& layout);
+
+public:
+	static DungeonLayout generate(const DungeonParams& params);
+
+	static Vector2D<int32_t> getTiles(const DungeonLayout& layout, const DungeonTiles& tiles, uint64_t seed);
+
+	// flags layer (walls and empty cells aren't passable).
+	static Vector2D<int32_t> getFlags(const DungeonLayout& layout);
+
+	// hash of the tile indexes, to compare generated maps.
+	static uint64_t hash(const Vector2D<int32_t>& tiles) noexcept;
+};
@@ -1,11 +1,16 @@
 #include "Level.h"
 #include "Game/Game.h"
+#include "Game/Item/Item.h"
 #include "Game/Player/Player.h"
+#include "Game/Projectile/Projectile.h"
+#include "Game/SimpleLevelObject/SimpleLevelObject.h"
 #include "LevelDraw.h"
 #include "LevelItem.h"
 #include "LevelQuest.h"
 #include "LevelSave.h"
 #include "LevelUIObject.h"
+#include "Utils/Profiler.h"
+#include "Utils/ThreadPool.h"
 
 void Level::save(const std::string_view filePath, const UnorderedStringMap<Variable>& props) const
 {
@@ -42,8 +47,117 @@ void Level::draw(const Game& game, sf::RenderTarget& target) const
 	LevelDraw::draw(*this, game, target);
 }
 
+void Level::updateLevelObjectFrames(const Game& game)
+{
+	PROFILE_ZONE("Level::updateLevelObjectFrames");
+
+	frameObjects.clear();
+	levelObjects.forEach([&](LevelObject& obj) { frameObjects.push_back(&obj); });
+
+	auto elapsedTime = game.getElapsedTime();
+	std::function<void(size_t)> updateFrame = [&](size_t idx)
+	{
+		frameObjects[idx]->updateFrame(elapsedTime, map);
+	};
+
+	switch (updateMode)
+	{
+	case LevelUpdateMode::Parallel:
+	{
+		ThreadPool::getDefault().parallelFor(frameObjects.size(), updateFrame);
+		break;
+	}
+	case LevelUpdateMode::VerifyFrames:
+	{
+		// run in parallel, rewind, run serially and compare.
+		frameStates.clear();
+		parallelFrameStates.clear();
+		for (const auto obj : frameObjects)
+		{
+			frameStates.push_back(obj->getFrameState());
+		}
+		ThreadPool::getDefault().parallelFor(frameObjects.size(), updateFrame);
+		for (size_t i = 0; i < frameObjects.size(); i++)
+		{
+			parallelFrameStates.push_back(frameObjects[i]->getFrameState());
+			frameObjects[i]->setFrameState(frameStates[i]);
+		}
+		for (size_t i = 0; i < frameObjects.size(); i++)
+		{
+			updateFrame(i);
+			if (frameObjects[i]->getFrameState() != parallelFrameStates[i])
+			{
+				frameMismatches++;
+			}
+		}
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+// players, items and simple objects are updated in the order they were added to the level.
+// objects removed while updating stay in the update order (and alive) until the pass ends,
+// so each object is passed its own entry. objects added while updating are updated in the next frame.
+void Level::updateLevelObjects(Game& game)
+{
+	const auto& updateOrder = levelObjects.updateOrder;
+	auto size = updateOrder.size();
+	levelObjects.beginUpdate();
+	for (size_t i = 0; i < size; i++)
+	{
+		const auto& obj = updateOrder[i];
+		if (levelObjects.get(obj->Handle()) != obj.get())
+		{
+			continue;
+		}
+		obj->update(game, *this, obj);
+	}
+	levelObjects.endUpdate();
+}
+
+// projectiles are updated like the other objects (hit and expire actions can add
+// or remove objects) and the expired ones are returned to the pool after the pass.
+void Level::updateProjectiles(Game& game)
+{
+	const auto& projectiles = levelObjects.projectiles;
+	updateHandles.clear();
+	for (const auto& obj : projectiles)
+	{
+		updateHandles.push_back(obj->Handle());
+	}
+	expiredProjectiles.clear();
+	for (const auto& handle : updateHandles)
+	{
+		auto objPtr = projectiles.getSharedPtr(handle);
+		if (objPtr == nullptr)
+		{
+			continue;
+		}
+		// keeps the projectile alive if its actions remove it.
+		auto obj = *objPtr;
+		auto projectile = static_cast<Projectile*>(obj.get());
+		projectile->update(game, *this, obj);
+		if (projectile->Expired() == true)
+		{
+			expiredProjectiles.push_back(handle);
+		}
+	}
+	for (const auto& handle : expiredProjectiles)
+	{
+		auto projectile = projectiles.get(handle);
+		if (projectile != nullptr)
+		{
+			levelObjects.releaseProjectile(map, *projectile);
+		}
+	}
+}
+
 void Level::update(Game& game)
 {
+	PROFILE_ZONE("Level::update");
+
 	if (visible == false)
 	{
 		return;
@@ -62,8 +176,13 @@ void Level::update(Game& game)
 	updateZoom(game);
 	updateMouse(game);
 	updateLights();
+	updateVisibleCells();
 
 	inputManager.processInput(*this, game);
+	updateHoverObject();
+
+	game.Resources().Sounds().setListener(
+		{ currentMapPosition.x, currentMapPosition.y }, soundDistance);
 
 	epoch++;
 
@@ -83,10 +202,15 @@ void Level::update(Game& game)
 		}
 	}
 
-	for (auto& obj : levelObjects.Objects())
+	// phase 1 only changes each object, phase 2 runs actions and map changes in order.
+	// in serial mode there's no phase 1 and objects step their animation in update.
+	if (updateMode != LevelUpdateMode::Serial)
 	{
-		obj->update(game, *this, obj);
+		updateLevelObjectFrames(game);
 	}
+	aiPathBudget = MaxAIPathsPerUpdate;
+	updateLevelObjects(game);
+	updateProjectiles(game);
 	if (currentMapPosition.x == -1.f &&
 		currentMapPosition.y == -1.f)
 	{
@@ -139,7 +263,7 @@ void Level::clearPlayerTextures() noexcept
 			continue;
 		}
 		bool classIsUsed = false;
-		for (const auto& obj : levelObjects.Objects())
+		for (const auto& obj : levelObjects.Players())
 		{
 			if (plrClass == obj->getBaseClass())
 			{
@@ -293,6 +417,36 @@ void Level::setQuestState(const std::string_view questId, int state) noexcept
 	LevelQuest::setQuestState(*this, questId, state);
 }
 
+bool Level::addProjectile(const SpellInstance& spellInstance,
+	const std::shared_ptr<Player>& owner, const PairFloat& target)
+{
+	if (spellInstance.spell == nullptr ||
+		owner == nullptr ||
+		spellInstance.spellOwner == nullptr)
+	{
+		return false;
+	}
+	LevelObjValue damage = 0;
+	LevelObjValue speed = 0;
+	LevelObjValue duration = 0;
+	LevelObjValue hitInterval = 0;
+	spellInstance.getNumberByHash(str2int16("damage"), damage);
+	spellInstance.getNumberByHash(str2int16("speed"), speed);
+	spellInstance.getNumberByHash(str2int16("duration"), duration);
+	spellInstance.getNumberByHash(str2int16("hitInterval"), hitInterval);
+	if (duration <= 0)
+	{
+		return false;
+	}
+	const auto& ownerPos = owner->MapPosition();
+	auto origin = PairFloat(ownerPos.x + 0.5f, ownerPos.y + 0.5f);
+	auto projectile = levelObjects.makeProjectile(spellInstance.spell);
+	projectile->init(spellInstance.spell, owner, origin,
+		PairFloat(target.x + 0.5f, target.y + 0.5f), damage, speed, duration, hitInterval);
+	levelObjects.add(map, projectile, ownerPos);
+	return true;
+}
+
 bool Level::hasSpell(const std::string_view id) const
 {
 	return levelObjects.getClass<Spell>(id) != nullptr;
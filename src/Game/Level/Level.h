@@ -5,6 +5,8 @@
 #include "Game/VarOrQueryObject.h"
 #include "LevelBase.h"
 
+struct SpellInstance;
+
 class Level : public ActionQueryable, public LevelBase
 {
 private:
@@ -16,6 +18,10 @@ private:
 	friend class LevelSave;
 	friend class LevelUIObject;
 
+	void updateLevelObjectFrames(const Game& game);
+	void updateLevelObjects(Game& game);
+	void updateProjectiles(Game& game);
+
 public:
 	void save(const std::string_view filePath, const UnorderedStringMap<Variable>& props) const;
 
@@ -39,6 +45,19 @@ public:
 
 	void setCurrentPlayer(std::weak_ptr<Player> player_) noexcept;
 
+	static constexpr uint32_t MaxAIPathsPerUpdate = 4;
+
+	// returns false if the AI players already used all path searches of this update.
+	bool useAIPathBudget() noexcept
+	{
+		if (aiPathBudget == 0)
+		{
+			return false;
+		}
+		aiPathBudget--;
+		return true;
+	}
+
 	bool FollowCurrentPlayer() const noexcept { return followCurrentPlayer; }
 	void FollowCurrentPlayer(bool follow) noexcept { followCurrentPlayer = follow; }
 
@@ -75,6 +94,11 @@ public:
 	bool hasQuest(const std::string_view questId) const noexcept;
 	void setQuestState(const std::string_view questId, int state) noexcept;
 
+	// fires the spell's projectile from the player towards the target map position.
+	// damage, speed (cells per second), duration (ms) and hitInterval (ms) come from the spell.
+	bool addProjectile(const SpellInstance& spellInstance,
+		const std::shared_ptr<Player>& owner, const PairFloat& target);
+
 	bool hasSpell(const std::string_view id) const;
 	Spell* getSpell(const std::string_view id) const;
 
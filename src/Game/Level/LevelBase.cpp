@@ -1,5 +1,6 @@
 #include "LevelBase.h"
 #include "Game/Game.h"
+#include "Game/Player/Player.h"
 #include "Utils/Utils.h"
 
 LevelBase::LevelBase()
@@ -14,6 +15,7 @@ void LevelBase::Init(const Game& game, LevelMap map_,
 	map = std::move(map_);
 	levelObjects.clearClickedObject();
 	levelObjects.clearHoverObject();
+	hoverObjectHandle = {};
 
 	surface.tileWidth = std::max(tileWidth, 2);
 	surface.tileHeight = std::max(tileHeight, 2);
@@ -81,6 +83,7 @@ void LevelBase::Init()
 {
 	levelObjects.clearClickedObject();
 	levelObjects.clearHoverObject();
+	hoverObjectHandle = {};
 
 	levelObjects.updatePositions(map);
 	viewNeedsUpdate = true;
@@ -295,9 +298,19 @@ void LevelBase::updateMouse(const Game& game)
 	mapCoordOverMouse = map.toMapCoord(mousePositionf2);
 }
 
+void LevelBase::updateHoverObject()
+{
+	if (enableHover == false || hasMouseInside == false)
+	{
+		hoverObjectHandle = {};
+		return;
+	}
+	hoverObjectHandle = hoverIndex.get(levelObjects, mousePositionf, mapCoordOverMouse);
+}
+
 void LevelBase::updateLights()
 {
-	map.updateLights(levelObjects.Objects(), currentMapViewCenter);
+	map.updateLights(levelObjects, currentMapViewCenter);
 	lights.clear();
 	for (const auto& light : map.AllLights())
 	{
@@ -311,6 +324,20 @@ void LevelBase::updateLights()
 	}
 }
 
+void LevelBase::updateVisibleCells()
+{
+	// the current player sees as far as its light reaches.
+	constexpr int32_t defaultVisibleRadius = 10;
+
+	auto player = levelObjects.CurrentPlayer();
+	if (player == nullptr)
+	{
+		return;
+	}
+	auto radius = (int32_t)player->getLightRadius();
+	map.updateVisibleCells(player->MapPosition(), radius > 0 ? radius : defaultVisibleRadius);
+}
+
 bool LevelBase::hasAutomap() const noexcept
 {
 	for (const auto& layer : reverse(levelLayers))
@@ -5,9 +5,11 @@
 #include "Game/Quest/Quest.h"
 #include "Game/UIObject.h"
 #include "LevelDrawableManager.h"
+#include "LevelHoverIndex.h"
 #include "LevelLayer.h"
 #include "LevelObjectManager.h"
 #include "LevelSurface.h"
+#include "LevelUpdateMode.h"
 #include "SFML/GradientCircle.h"
 #include "Utils/EasedValue.h"
 #include "Utils/FixedArray.h"
@@ -25,9 +27,13 @@ protected:
 
 	GameShader* gameShader{ nullptr };
 	float lightRadius{ 64.f };
+	// sounds made further than this (in tiles) from the view center are not played
+	float soundDistance{ 20.f };
 	sf::Vector2f automapPosition{ 0.f, 0.f };
 	sf::Vector2f automapSize{ 1.f, 1.f };
 	bool automapRelativeCoords{ true };
+	// only draw the automap cells the current player has explored.
+	bool automapExploredOnly{ false };
 	bool viewNeedsUpdate{ false };
 	EasedValuef zoomValue{ 1.f };
 	bool zoomDrawables{ false };
@@ -41,6 +47,11 @@ protected:
 	bool hasMouseInside{ false };
 
 	PairFloat mapCoordOverMouse;
+
+	// rebuilt when drawing, used to find the hovered object in the next update.
+	mutable LevelHoverIndex hoverIndex;
+	LevelObjectHandle hoverObjectHandle;
+
 	PairFloat currentMapPosition;
 	PairFloat clickedMapPosition;
 
@@ -76,6 +87,17 @@ protected:
 
 	int epoch{ 0 };
 
+	LevelUpdateMode updateMode{ LevelUpdateMode::Serial };
+	uint32_t frameMismatches{ 0 };
+	std::vector<LevelObject*> frameObjects;
+	std::vector<LevelObjectFrameState> frameStates;
+	std::vector<LevelObjectFrameState> parallelFrameStates;
+	std::vector<LevelObjectHandle> expiredProjectiles;
+	std::vector<LevelObjectHandle> updateHandles;
+
+	// path searches the AI players can still do in this update.
+	uint32_t aiPathBudget{ 0 };
+
 	LevelInputManager inputManager;
 
 	static auto& get(int32_t x, int32_t y, const LevelBase& level) noexcept { return level.map[x][y]; }
@@ -90,7 +112,9 @@ protected:
 	LevelObject* parseLevelObjectIdOrMapPosition(const std::string_view str, std::string_view& props) const;
 
 	void updateLights();
+	void updateVisibleCells();
 	void updateMouse(const Game& game);
+	void updateHoverObject();
 	void updateTilesetLayersVisibleArea();
 	void updateZoom(const Game& game);
 
@@ -152,6 +176,8 @@ public:
 	void Size(const sf::Vector2f& size) override;
 
 	float LightRadius() const noexcept { return lightRadius; }
+	float SoundDistance() const noexcept { return soundDistance; }
+	void SoundDistance(float soundDistance_) noexcept { soundDistance = soundDistance_; }
 	void LightRadius(float lightRadius_) noexcept;
 
 	bool getAutomapRelativeCoords() const noexcept { return automapRelativeCoords; }
@@ -176,6 +202,12 @@ public:
 	void addLevelObject(std::shared_ptr<LevelObject> obj);
 
 	auto& getMapCoordOverMouse() const noexcept { return mapCoordOverMouse; }
+
+	const LevelHoverIndex& HoverIndex() const noexcept { return hoverIndex; }
+
+	// adds an object drawn by a level layer, which draws a const level.
+	void addToHoverIndex(const LevelObject& obj) const { hoverIndex.add(obj); }
+	auto& HoverObjectHandle() const noexcept { return hoverObjectHandle; }
 	auto& getClickedMapPosition() const noexcept { return clickedMapPosition; }
 
 	void move(const PairFloat& mapPos, bool smooth) { setCurrentMapPosition(mapPos, smooth); }
@@ -183,6 +215,12 @@ public:
 
 	void setSmoothMovement(bool smooth) noexcept { smoothMovement = smooth; }
 
+	auto getUpdateMode() const noexcept { return updateMode; }
+	void setUpdateMode(LevelUpdateMode mode) noexcept { updateMode = mode; }
+
+	// number of objects whose parallel first phase differed from the serial one (VerifyFrames mode).
+	auto FrameMismatches() const noexcept { return frameMismatches; }
+
 	auto TileWidth() const noexcept { return surface.tileWidth; }
 	auto TileHeight() const noexcept { return surface.tileHeight; }
 	auto SubTiles() const noexcept { return surface.subTiles; }
@@ -207,6 +245,9 @@ public:
 
 	bool hasAutomap() const noexcept;
 
+	bool AutomapExploredOnly() const noexcept { return automapExploredOnly; }
+	void AutomapExploredOnly(bool exploredOnly) noexcept { automapExploredOnly = exploredOnly; }
+
 	bool ShowAutomap() const noexcept { return automapSurface.visible; }
 	void ShowAutomap(bool show) noexcept { automapSurface.visible = show; }
 
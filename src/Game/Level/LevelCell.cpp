@@ -1,39 +1,41 @@
 #include "LevelCell.h"
 
-bool LevelCell::PassableIgnoreObject(const LevelObject* ignoreObj) const
+void LevelCell::addFlags(const LevelObject* obj)
 {
-	if (PassableIgnoreObject() == false)
+	objectTypes |= getTypeBit(obj->getObjectType());
+	if (obj->Passable() == false)
 	{
-		return false;
+		blockingObjects++;
 	}
+}
+
+void LevelCell::updateFlags() noexcept
+{
+	objectTypes = 0;
+	blockingObjects = 0;
 	for (const auto obj : objects)
 	{
-		if (obj == ignoreObj)
-		{
-			continue;
-		}
-		if (obj->Passable() == false)
-		{
-			return false;
-		}
+		addFlags(obj);
 	}
-	return true;
 }
 
-bool LevelCell::Passable() const
+bool LevelCell::PassableIgnoreObject(const LevelObject* ignoreObj) const
 {
 	if (PassableIgnoreObject() == false)
 	{
 		return false;
 	}
-	for (const auto obj : objects)
+	if (blockingObjects == 0)
 	{
-		if (obj->Passable() == false)
-		{
-			return false;
-		}
+		return true;
+	}
+	if (blockingObjects > 1 ||
+		ignoreObj == nullptr ||
+		ignoreObj->Passable() == true)
+	{
+		return false;
 	}
-	return true;
+	return std::find(objects.begin(), objects.end(), ignoreObj) != objects.end();
 }
 
 LevelObject* LevelCell::back() const
@@ -58,7 +60,8 @@ void LevelCell::addFront(LevelObject* obj)
 {
 	if (std::find(objects.begin(), objects.end(), obj) == objects.end())
 	{
-		objects.insert(objects.begin(), obj);
+		objects.insert(0, obj);
+		addFlags(obj);
 	}
 }
 
@@ -67,16 +70,18 @@ void LevelCell::addBack(LevelObject* obj)
 	if (std::find(objects.begin(), objects.end(), obj) == objects.end())
 	{
 		objects.push_back(obj);
+		addFlags(obj);
 	}
 }
 
 bool LevelCell::removeObject(const LevelObject* obj)
 {
-	for (auto it = objects.begin(); it != objects.end(); ++it)
+	for (size_t i = 0; i < objects.size(); i++)
 	{
-		if (*it == obj)
+		if (objects[i] == obj)
 		{
-			objects.erase(it);
+			objects.erase(i);
+			updateFlags();
 			return true;
 		}
 	}
@@ -4,7 +4,8 @@
 #include "Game/Item/Item.h"
 #include "Game/LevelObject/LevelObject.h"
 #include "LevelFlags.h"
-#include <vector>
+#include <type_traits>
+#include "Utils/SmallVector.h"
 
 class LevelCell
 {
@@ -15,7 +16,16 @@ public:
 
 private:
 	std::array<int32_t, NumberOfLayers> tileIndexes{ -1, -1, -1, -1,- 1, -1, -1, -1, -1, -1, -1, 0 };
-	std::vector<LevelObject*> objects;
+	SmallVector<LevelObject*, 2> objects;
+
+	// cached from objects. one bit per LevelObjectType.
+	uint8_t objectTypes{ 0 };
+	// number of objects that aren't passable.
+	uint8_t blockingObjects{ 0 };
+
+	static constexpr uint8_t getTypeBit(LevelObjectType type) noexcept { return (uint8_t)(1u << (uint8_t)type); }
+
+	void addFlags(const LevelObject* obj);
 
 public:
 	auto begin() noexcept { return objects.begin(); }
@@ -41,22 +51,49 @@ public:
 
 	bool PassableIgnoreObject() const noexcept { return LevelFlags::Passable(tileIndexes[FlagsLayer]); }
 	bool PassableIgnoreObject(const LevelObject* ignoreObj) const;
-	bool Passable() const;
+	bool Passable() const noexcept { return PassableIgnoreObject() == true && blockingObjects == 0; }
 
 	LevelObject* back() const;
 	LevelObject* front() const;
 
 	bool hasObjects() const noexcept { return objects.empty() == false; }
 
+	bool hasObject(LevelObjectType type) const noexcept { return (objectTypes & getTypeBit(type)) != 0; }
+
+	template <class T>
+	bool hasObject() const noexcept { return getObject<T>() != nullptr; }
+
 	template <class T>
 	T* getObject() const noexcept
 	{
-		for (const auto object : objects)
+		constexpr auto type = getLevelObjectType<T>();
+		if constexpr (std::is_same_v<T, LevelObject> == true)
+		{
+			return front();
+		}
+		else if constexpr (type != LevelObjectType::Unknown)
+		{
+			if (hasObject(type) == false)
+			{
+				return nullptr;
+			}
+			for (const auto object : objects)
+			{
+				if (object->getObjectType() == type)
+				{
+					return static_cast<T*>(object);
+				}
+			}
+		}
+		else
 		{
-			const auto castObj = dynamic_cast<T*>(object);
-			if (castObj != nullptr)
+			for (const auto object : objects)
 			{
-				return castObj;
+				const auto castObj = dynamic_cast<T*>(object);
+				if (castObj != nullptr)
+				{
+					return castObj;
+				}
 			}
 		}
 		return nullptr;
@@ -69,15 +106,14 @@ public:
 	template <class T>
 	T* removeObject()
 	{
-		for (auto it = objects.begin(); it != objects.end(); ++it)
+		auto obj = getObject<T>();
+		if (obj != nullptr)
 		{
-			auto oldObj = dynamic_cast<T*>(*it);
-			if (oldObj != nullptr)
-			{
-				objects.erase(it);
-				return oldObj;
-			}
+			removeObject(obj);
 		}
-		return nullptr;
+		return obj;
 	}
+
+	// recomputes the cached flags. call if an object's passability changes.
+	void updateFlags() noexcept;
 };
@@ -3,9 +3,12 @@
 #include "Game/Game.h"
 #include "Level.h"
 #include "LevelLayer.h"
+#include "Utils/Profiler.h"
 
 void LevelDraw::draw(const Level& level, const Game& game, sf::RenderTarget& target)
 {
+	PROFILE_ZONE("LevelDraw::draw");
+
 	if (level.visible == false)
 	{
 		return;
@@ -17,6 +20,7 @@ void LevelDraw::draw(const Level& level, const Game& game, sf::RenderTarget& tar
 
 	level.surface.clear(sf::Color::Black);
 	level.automapSurface.clear(sf::Color::Transparent);
+	level.hoverIndex.clear(level.surface.visibleRect);
 
 	SpriteShaderCache spriteCache;
 
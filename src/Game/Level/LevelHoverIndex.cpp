@@ -0,0 +1,100 @@
+#include "LevelHoverIndex.h"
+#include <algorithm>
+#include <cmath>
+#include "Game/LevelObject/LevelObject.h"
+#include "LevelObjectManager.h"
+
+void LevelHoverIndex::clear(const sf::FloatRect& area_)
+{
+	area = area_;
+	columns = std::max((int32_t)std::ceil(area.width / BucketSize), 1);
+	rows = std::max((int32_t)std::ceil(area.height / BucketSize), 1);
+	buckets.resize((size_t)(columns * rows));
+	for (auto& bucket : buckets)
+	{
+		bucket.clear();
+	}
+	entries.clear();
+	cellEntries.clear();
+}
+
+bool LevelHoverIndex::getBucket(const sf::Vector2f& point, int32_t& column, int32_t& row) const noexcept
+{
+	column = (int32_t)std::floor((point.x - area.left) / BucketSize);
+	row = (int32_t)std::floor((point.y - area.top) / BucketSize);
+	return column >= 0 && column < columns && row >= 0 && row < rows;
+}
+
+void LevelHoverIndex::add(const LevelObject& obj)
+{
+	if (obj.Hoverable() == false ||
+		obj.Handle().isValid() == false)
+	{
+		return;
+	}
+	auto idx = (uint32_t)entries.size();
+	auto rect = obj.getGlobalBounds();
+	entries.push_back({ obj.Handle(), rect });
+
+	auto cellSize = obj.getCellSize();
+	if (cellSize.x != 0 && cellSize.y != 0)
+	{
+		cellEntries.push_back(idx);
+		return;
+	}
+	if (area.intersects(rect) == false)
+	{
+		return;
+	}
+	int32_t startColumn, startRow, endColumn, endRow;
+	getBucket({ rect.left, rect.top }, startColumn, startRow);
+	getBucket({ rect.left + rect.width, rect.top + rect.height }, endColumn, endRow);
+	startColumn = std::clamp(startColumn, 0, columns - 1);
+	startRow = std::clamp(startRow, 0, rows - 1);
+	endColumn = std::clamp(endColumn, 0, columns - 1);
+	endRow = std::clamp(endRow, 0, rows - 1);
+	for (auto row = startRow; row <= endRow; row++)
+	{
+		for (auto column = startColumn; column <= endColumn; column++)
+		{
+			buckets[(size_t)(column + row * columns)].push_back(idx);
+		}
+	}
+}
+
+LevelObjectHandle LevelHoverIndex::get(const LevelObjectManager& levelObjects,
+	const sf::Vector2f& mousePos, const PairFloat& mouseMapPos) const
+{
+	// entries are in draw order, so the last one hit is the top-most.
+	const Entry* topEntry = nullptr;
+	int32_t column, row;
+	if (getBucket(mousePos, column, row) == true)
+	{
+		const auto& bucket = buckets[(size_t)(column + row * columns)];
+		for (auto it = bucket.rbegin(); it != bucket.rend(); ++it)
+		{
+			const auto& entry = entries[*it];
+			if (entry.rect.contains(mousePos) == true &&
+				levelObjects.get(entry.handle) != nullptr)
+			{
+				topEntry = &entry;
+				break;
+			}
+		}
+	}
+	for (auto it = cellEntries.rbegin(); it != cellEntries.rend(); ++it)
+	{
+		const auto& entry = entries[*it];
+		if (topEntry != nullptr && &entry < topEntry)
+		{
+			break;
+		}
+		auto obj = levelObjects.get(entry.handle);
+		if (obj != nullptr && obj->hitTest(mouseMapPos) == true)
+		{
+			topEntry = &entry;
+			break;
+		}
+	}
+	return topEntry != nullptr ? topEntry->handle : LevelObjectHandle();
+}
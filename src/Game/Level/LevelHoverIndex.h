@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Game/LevelObject/LevelObjectHandle.h"
+#include <SFML/Graphics/Rect.hpp>
+#include "Utils/PairXY.h"
+#include <vector>
+
+class LevelObject;
+class LevelObjectManager;
+
+// grid of the rects of the level objects drawn in the last frame, in draw order,
+// so the object under the mouse is resolved once per frame and the top-most one wins.
+class LevelHoverIndex
+{
+public:
+	static constexpr float BucketSize = 128.f;
+
+private:
+	struct Entry
+	{
+		LevelObjectHandle handle;
+		sf::FloatRect rect;
+	};
+
+	sf::FloatRect area;
+	int32_t columns{ 0 };
+	int32_t rows{ 0 };
+	std::vector<Entry> entries;
+	std::vector<std::vector<uint32_t>> buckets;
+	// objects that occupy more than one cell are hovered by map position, not by rect.
+	std::vector<uint32_t> cellEntries;
+
+	bool getBucket(const sf::Vector2f& point, int32_t& column, int32_t& row) const noexcept;
+
+public:
+	// removes all objects and sets the area (visible rect) that's indexed.
+	void clear(const sf::FloatRect& area_);
+
+	// adds a drawn object. objects drawn later are on top.
+	void add(const LevelObject& obj);
+
+	// top-most object under the mouse, or an invalid handle.
+	LevelObjectHandle get(const LevelObjectManager& levelObjects,
+		const sf::Vector2f& mousePos, const PairFloat& mouseMapPos) const;
+
+	auto size() const noexcept { return entries.size(); }
+};
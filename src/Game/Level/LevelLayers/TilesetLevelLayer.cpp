@@ -3,6 +3,7 @@
 #include "Game/Level/LevelSurface.h"
 #include "Game/Player/Player.h"
 #include "SFML/VertexArray2.h"
+#include "Utils/Profiler.h"
 
 void TilesetLevelLayer::updateVisibleArea(const LevelSurface& surface, const LevelMap& map)
 {
@@ -82,10 +83,121 @@ static void addTile(std::vector<sf::Vertex>& vertices,
 	vertices[vertIdx].texCoords.y = (float)textureRect.top + (float)textureRect.height;
 }
 
+void TilesetLevelLayer::addChunk(std::vector<sf::Vertex>& vertices, const LevelSurface& surface,
+	const LevelMap& map, const PairInt32& chunk, bool exploredOnly) const
+{
+	TextureInfo ti;
+	PairInt32 chunkStart(chunk.x * TilesetLevelLayerCache::ChunkSize, chunk.y * TilesetLevelLayerCache::ChunkSize);
+	PairInt32 mapPos;
+	for (mapPos.x = chunkStart.x; mapPos.x < chunkStart.x + TilesetLevelLayerCache::ChunkSize; mapPos.x++)
+	{
+		for (mapPos.y = chunkStart.y; mapPos.y < chunkStart.y + TilesetLevelLayerCache::ChunkSize; mapPos.y++)
+		{
+			if (exploredOnly == true &&
+				map.isExplored(mapPos) == false)
+			{
+				continue;
+			}
+			int32_t index;
+			if (map.isMapCoordValid(mapPos) == false)
+			{
+				index = outOfBoundsTile.getTileIndex(mapPos.x, mapPos.y);
+			}
+			else
+			{
+				index = map[mapPos].getTileIndex(layerIdx);
+			}
+			while (index >= 0 && tiles->get((uint32_t)index, ti) == true)
+			{
+				PROFILE_COUNT(ProfilerCounter::TextureFetches);
+				auto drawPos = map.toDrawCoord(mapPos, surface.blockWidth, surface.blockHeight);
+				drawPos += ti.offset;
+				addTile(vertices, drawPos.x, drawPos.y, ti.textureRect);
+				index = ti.nextIndex;
+			}
+		}
+	}
+}
+
+void TilesetLevelLayer::addCachedChunks(std::vector<sf::Vertex>& vertices, const LevelSurface& surface,
+	const LevelMap& map, bool exploredOnly) const
+{
+	auto toChunk = [](int32_t val)
+	{
+		return (val >= 0 ? val : val - TilesetLevelLayerCache::ChunkSize + 1) / TilesetLevelLayerCache::ChunkSize;
+	};
+
+	if (cache == nullptr)
+	{
+		cache = std::make_shared<TilesetLevelLayerCache>();
+	}
+	if (cache->tilesVersion != map.TilesVersion() ||
+		cache->exploredOnly != exploredOnly ||
+		(exploredOnly == true && map.ExploredVersion() - cache->exploredVersion > 1u) ||
+		cache->tiles != tiles.get() ||
+		cache->blockWidth != surface.blockWidth ||
+		cache->blockHeight != surface.blockHeight ||
+		cache->chunks.size() > TilesetLevelLayerCache::MaxChunks)
+	{
+		cache->chunks.clear();
+		cache->tilesVersion = map.TilesVersion();
+		cache->exploredOnly = exploredOnly;
+		cache->tiles = tiles.get();
+		cache->blockWidth = surface.blockWidth;
+		cache->blockHeight = surface.blockHeight;
+	}
+	else if (exploredOnly == true && cache->exploredVersion != map.ExploredVersion())
+	{
+		// only rebuild the chunks with newly explored cells.
+		const auto& areaStart = map.ExploredAreaStart();
+		const auto& areaEnd = map.ExploredAreaEnd();
+		for (auto it = cache->chunks.begin(); it != cache->chunks.end();)
+		{
+			PairInt32 chunk((int32_t)(it->first >> 32), (int32_t)(uint32_t)it->first);
+			if (chunk.x >= toChunk(areaStart.x) && chunk.x <= toChunk(areaEnd.x - 1) &&
+				chunk.y >= toChunk(areaStart.y) && chunk.y <= toChunk(areaEnd.y - 1))
+			{
+				it = cache->chunks.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+	cache->exploredVersion = map.ExploredVersion();
+
+	if (visibleEnd.x <= visibleStart.x ||
+		visibleEnd.y <= visibleStart.y)
+	{
+		return;
+	}
+	PairInt32 chunkStart(toChunk(visibleStart.x), toChunk(visibleStart.y));
+	PairInt32 chunkEnd(toChunk(visibleEnd.x - 1), toChunk(visibleEnd.y - 1));
+
+	PairInt32 chunk;
+	for (chunk.x = chunkStart.x; chunk.x <= chunkEnd.x; chunk.x++)
+	{
+		for (chunk.y = chunkStart.y; chunk.y <= chunkEnd.y; chunk.y++)
+		{
+			auto key = ((uint64_t)(uint32_t)chunk.x << 32) | (uint64_t)(uint32_t)chunk.y;
+			auto it = cache->chunks.find(key);
+			if (it == cache->chunks.end())
+			{
+				it = cache->chunks.emplace(key, std::vector<sf::Vertex>()).first;
+				addChunk(it->second, surface, map, chunk, exploredOnly);
+			}
+			vertices.insert(vertices.end(), it->second.begin(), it->second.end());
+		}
+	}
+}
+
 void TilesetLevelLayer::draw(const LevelSurface& surface,
 	SpriteShaderCache& spriteCache, GameShader* spriteShader,
 	const Level& level, bool drawLevelObjects, bool isAutomap) const
 {
+	PROFILE_ZONE("TilesetLevelLayer::draw");
+
 	VertexArray2 vertexLayer;
 	Sprite2 sprite;
 	TextureInfo ti;
@@ -113,58 +225,79 @@ void TilesetLevelLayer::draw(const LevelSurface& surface,
 	}
 
 	const auto& map = level.Map();
-	PairInt32 mapPos;
-	for (mapPos.x = visibleStart.x; mapPos.x < visibleEnd.x; mapPos.x++)
+
+	bool exploredOnly = isAutomap == true && level.AutomapExploredOnly() == true;
+
+	// the automap only changes when the map's tiles or the explored cells do, so its vertices are cached.
+	bool useCache = isAutomap == true &&
+		tilesetTexture != nullptr &&
+		tiles->isAnimated() == false;
+	if (useCache == true)
+	{
+		addCachedChunks(vertexLayer.vertices, surface, map, exploredOnly);
+	}
+	else
 	{
-		for (mapPos.y = visibleStart.y; mapPos.y < visibleEnd.y; mapPos.y++)
+		PairInt32 mapPos;
+		for (mapPos.x = visibleStart.x; mapPos.x < visibleEnd.x; mapPos.x++)
 		{
-			int32_t index;
-			if (map.isMapCoordValid(mapPos) == false)
+			for (mapPos.y = visibleStart.y; mapPos.y < visibleEnd.y; mapPos.y++)
 			{
-				index = outOfBoundsTile.getTileIndex(mapPos.x, mapPos.y);
-			}
-			else
-			{
-				index = map[mapPos].getTileIndex(layerIdx);
-
-				if (drawLevelObjects == true)
+				if (exploredOnly == true &&
+					map.isExplored(mapPos) == false)
 				{
-					for (const auto& drawObj : map[mapPos])
+					continue;
+				}
+				int32_t index;
+				if (map.isMapCoordValid(mapPos) == false)
+				{
+					index = outOfBoundsTile.getTileIndex(mapPos.x, mapPos.y);
+				}
+				else
+				{
+					index = map[mapPos].getTileIndex(layerIdx);
+
+					if (drawLevelObjects == true)
 					{
-						if (drawObj != nullptr)
+						for (const auto& drawObj : map[mapPos])
 						{
-							surface.draw(*drawObj, spriteShader, spriteCache);
+							if (drawObj != nullptr)
+							{
+								surface.draw(*drawObj, spriteShader, spriteCache);
+								level.addToHoverIndex(*drawObj);
+							}
+						}
+						if (tiles == nullptr ||
+							surface.visible == false)
+						{
+							continue;
 						}
-					}
-					if (tiles == nullptr ||
-						surface.visible == false)
-					{
-						continue;
 					}
 				}
-			}
-			while (index >= 0 && tiles->get((uint32_t)index, ti) == true)
-			{
-				auto drawPos = map.toDrawCoord(mapPos, surface.blockWidth, surface.blockHeight);
-				drawPos += ti.offset;
-				tileRect.left = drawPos.x;
-				tileRect.top = drawPos.y;
-				tileRect.width = (float)ti.textureRect.width;
-				tileRect.height = (float)ti.textureRect.height;
-				if (surface.visibleRect.intersects(tileRect) == true)
+				while (index >= 0 && tiles->get((uint32_t)index, ti) == true)
 				{
-					if (tilesetTexture == nullptr)
-					{
-						sprite.setPosition(drawPos);
-						sprite.setTexture(ti, true);
-						surface.draw(sprite, spriteShader, spriteCache);
-					}
-					else
+					PROFILE_COUNT(ProfilerCounter::TextureFetches);
+					auto drawPos = map.toDrawCoord(mapPos, surface.blockWidth, surface.blockHeight);
+					drawPos += ti.offset;
+					tileRect.left = drawPos.x;
+					tileRect.top = drawPos.y;
+					tileRect.width = (float)ti.textureRect.width;
+					tileRect.height = (float)ti.textureRect.height;
+					if (surface.visibleRect.intersects(tileRect) == true)
 					{
-						addTile(vertexLayer.vertices, drawPos.x, drawPos.y, ti.textureRect);
+						if (tilesetTexture == nullptr)
+						{
+							sprite.setPosition(drawPos);
+							sprite.setTexture(ti, true);
+							surface.draw(sprite, spriteShader, spriteCache);
+						}
+						else
+						{
+							addTile(vertexLayer.vertices, drawPos.x, drawPos.y, ti.textureRect);
+						}
 					}
+					index = ti.nextIndex;
 				}
-				index = ti.nextIndex;
 			}
 		}
 	}
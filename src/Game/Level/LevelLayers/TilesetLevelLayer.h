@@ -4,13 +4,32 @@
 #include "Resources/TexturePack.h"
 #include "Resources/TileBlock.h"
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include "SFML/Sprite2.h"
+#include <unordered_map>
 #include "Utils/PairXY.h"
+#include <vector>
 
 class Level;
 class LevelMap;
 class LevelSurface;
 
+// tile vertices of a layer, built per chunk of cells the first time it's visible
+// and reused until the map's tiles, the tiles or the block size change.
+struct TilesetLevelLayerCache
+{
+	static constexpr int32_t ChunkSize = 16;
+	static constexpr size_t MaxChunks = 1024;
+
+	uint32_t tilesVersion{ 0 };
+	uint32_t exploredVersion{ 0 };
+	bool exploredOnly{ false };
+	const TexturePack* tiles{ nullptr };
+	int32_t blockWidth{ 0 };
+	int32_t blockHeight{ 0 };
+	std::unordered_map<uint64_t, std::vector<sf::Vertex>> chunks;
+};
+
 struct TilesetLevelLayer
 {
 	std::shared_ptr<TexturePack> tiles;
@@ -19,6 +38,9 @@ struct TilesetLevelLayer
 	uint16_t layerIdx{ 0 };
 	TileBlock outOfBoundsTile;
 
+	// only used by the automap, which doesn't change between frames.
+	mutable std::shared_ptr<TilesetLevelLayerCache> cache;
+
 	TilesetLevelLayer() {}
 	TilesetLevelLayer(const std::shared_ptr<TexturePack>& tiles_,
 		uint16_t layerIdx_, const TileBlock& outOfBoundsTile_)
@@ -29,4 +51,11 @@ struct TilesetLevelLayer
 	void draw(const LevelSurface& surface,
 		SpriteShaderCache& spriteCache, GameShader* spriteShader,
 		const Level& level, bool drawLevelObjects, bool isAutomap) const;
+
+private:
+	void addChunk(std::vector<sf::Vertex>& vertices, const LevelSurface& surface,
+		const LevelMap& map, const PairInt32& chunk, bool exploredOnly) const;
+
+	void addCachedChunks(std::vector<sf::Vertex>& vertices, const LevelSurface& surface,
+		const LevelMap& map, bool exploredOnly) const;
 };
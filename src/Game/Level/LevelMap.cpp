@@ -1,6 +1,8 @@
 #include "LevelMap.h"
+#include "LevelObjectManager.h"
 #include "PathFinder.h"
 #include "Utils/EasingFunctions.h"
+#include "Utils/Profiler.h"
 
 uint32_t LevelMap::maxLights{ MaxNumberOfLightsToUse };
 
@@ -26,16 +28,34 @@ LevelMap::LevelMap(int32_t width_, int32_t height_, int32_t defaultTile)
 
 void LevelMap::resize(int32_t width_, int32_t height_)
 {
+	tilesVersion++;
 	mapSizei.x = std::clamp(width_, 0, (int32_t)std::numeric_limits<uint16_t>::max());
 	mapSizei.y = std::clamp(height_, 0, (int32_t)std::numeric_limits<uint16_t>::max());
 	mapSizef.x = (float)mapSizei.x;
 	mapSizef.y = (float)mapSizei.y;
 
 	cells.resize(mapSizei.x * mapSizei.y, {});
+
+	if (exploredCells.Size() != mapSizei)
+	{
+		exploredCells.resize(mapSizei);
+		visibleCells.resize(mapSizei);
+		visibleRadius = -1;
+		exploredVersion++;
+		exploredAreaStart = {};
+		exploredAreaEnd = mapSizei;
+	}
 }
 
 void LevelMap::clear(int32_t defaultTile)
 {
+	tilesVersion++;
+	exploredCells.clear();
+	visibleCells.clear();
+	visibleRadius = -1;
+	exploredVersion++;
+	exploredAreaStart = {};
+	exploredAreaEnd = mapSizei;
 	if (defaultTile < 0)
 	{
 		cells.assign(cells.size(), {});
@@ -107,8 +127,10 @@ void LevelMap::updateMapLights()
 	}
 }
 
-void LevelMap::updateLights(const std::vector<std::shared_ptr<LevelObject>>& levelObjects, const sf::Vector2f& drawCenter)
+void LevelMap::updateLights(const LevelObjectManager& levelObjects, const sf::Vector2f& drawCenter)
 {
+	PROFILE_ZONE("LevelMap::updateLights");
+
 	if (defaultLight.light == 255 ||
 		maxLights == 0)
 	{
@@ -122,17 +144,17 @@ void LevelMap::updateLights(const std::vector<std::shared_ptr<LevelObject>>& lev
 
 	LightStruct ls;
 	allLights.clear();
-	for (const auto& levelObject : levelObjects)
-	{
-		ls.lightSource = levelObject->getLightSource();
-		if (ls.lightSource.light > 0 &&
-			ls.lightSource.radius > 0)
+	levelObjects.forEach([this, &ls](const LevelObject& levelObject)
 		{
-			ls.mapPos = levelObject->MapPosition();
-			ls.drawPos = levelObject->getBasePosition();
-			allLights.push_back(ls);
-		}
-	}
+			ls.lightSource = levelObject.getLightSource();
+			if (ls.lightSource.light > 0 &&
+				ls.lightSource.radius > 0)
+			{
+				ls.mapPos = levelObject.MapPosition();
+				ls.drawPos = levelObject.getBasePosition();
+				allLights.push_back(ls);
+			}
+		});
 
 	allLights.insert(allLights.end(), mapLights.begin(), mapLights.end());
 
@@ -186,6 +208,7 @@ void LevelMap::getSubIndex(int32_t x, int32_t y, uint32_t& subIndex)
 
 void LevelMap::setTileSetAreaUseFlags(int32_t x, int32_t y, const Vector2D<int32_t>& vec)
 {
+	tilesVersion++;
 	lightsNeedUpdate = true;
 	auto flags = getFlags();
 	auto dWidth = vec.Width() * 2;
@@ -253,6 +276,7 @@ void LevelMap::setTileSetAreaUseFlags(int32_t x, int32_t y, const Vector2D<int32
 
 void LevelMap::setSimpleAreaUseFlags(size_t layer, int32_t x, int32_t y, const Vector2D<int32_t>& vec)
 {
+	tilesVersion++;
 	if (layer == 0)
 	{
 		lightsNeedUpdate = true;
@@ -289,6 +313,7 @@ void LevelMap::setSimpleArea(size_t layer, int32_t x, int32_t y, const Vector2D<
 	{
 		return;
 	}
+	tilesVersion++;
 	if (layer == 0)
 	{
 		lightsNeedUpdate = true;
@@ -321,6 +346,7 @@ void LevelMap::setSimpleArea(size_t layer, int32_t x, int32_t y, const Vector2D<
 #ifdef DGENGINE_DIABLO_FORMAT_SUPPORT
 void LevelMap::setD2Area(int32_t x, int32_t y, DS1::Decoder& dun)
 {
+	tilesVersion++;
 	resize(dun.width * defaultSubTiles, dun.height * defaultSubTiles);
 
 	size_t currLayer = 0;
@@ -493,6 +519,156 @@ bool LevelMap::removeLevelObject(const LevelObject* obj)
 	return obj->remove(*this);
 }
 
+bool LevelMap::hasLineOfSight(const PairInt32& a, const PairInt32& b) const noexcept
+{
+	auto dx = std::abs(b.x - a.x);
+	auto dy = -std::abs(b.y - a.y);
+	auto stepX = a.x < b.x ? 1 : -1;
+	auto stepY = a.y < b.y ? 1 : -1;
+	auto err = dx + dy;
+	auto x = a.x;
+	auto y = a.y;
+	while (x != b.x || y != b.y)
+	{
+		auto err2 = 2 * err;
+		if (err2 >= dy)
+		{
+			err += dy;
+			x += stepX;
+		}
+		if (err2 <= dx)
+		{
+			err += dx;
+			y += stepY;
+		}
+		if (x == b.x && y == b.y)
+		{
+			break;
+		}
+		if (isMapCoordValid(x, y) == false ||
+			get(x, y, *this).PassableIgnoreObject() == false)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool LevelMap::avoidBlockedStep(const LevelObject& obj, std::vector<PairFloat>& walkPath) const
+{
+	if (walkPath.empty() == true ||
+		isMapCoordValid(walkPath.back()) == false)
+	{
+		return false;
+	}
+	const auto& nextMapPos = walkPath.back();
+	if ((*this)[nextMapPos].PassableIgnoreObject(&obj) == true)
+	{
+		return true;
+	}
+	if (walkPath.size() < 2)
+	{
+		return false;
+	}
+	const auto& mapPos = obj.MapPosition();
+	const auto& afterMapPos = walkPath[walkPath.size() - 2];
+	PairFloat sidestep = mapPos;
+	float sidestepDistance = 3.f;
+	for (int32_t y = -1; y <= 1; y++)
+	{
+		for (int32_t x = -1; x <= 1; x++)
+		{
+			PairFloat cell(mapPos.x + (float)x, mapPos.y + (float)y);
+			if (cell == mapPos ||
+				cell == nextMapPos ||
+				std::abs(cell.x - afterMapPos.x) > 1.f ||
+				std::abs(cell.y - afterMapPos.y) > 1.f ||
+				isMapCoordValid(cell) == false ||
+				(*this)[cell].Passable() == false)
+			{
+				continue;
+			}
+			auto distance = std::abs(cell.x - afterMapPos.x) + std::abs(cell.y - afterMapPos.y);
+			if (distance < sidestepDistance)
+			{
+				sidestep = cell;
+				sidestepDistance = distance;
+			}
+		}
+	}
+	if (sidestep == mapPos)
+	{
+		return false;
+	}
+	walkPath.pop_back();
+	if (sidestep != walkPath.back())
+	{
+		walkPath.push_back(sidestep);
+	}
+	return true;
+}
+
+void LevelMap::setExploredCells(const std::vector<uint32_t>& runs)
+{
+	exploredCells.setRuns(runs);
+	exploredVersion++;
+	exploredAreaStart = {};
+	exploredAreaEnd = mapSizei;
+}
+
+void LevelMap::updateVisibleCells(const PairFloat& center, int32_t radius)
+{
+	PairInt32 centerCell((int32_t)center.x, (int32_t)center.y);
+	if (centerCell == visibleCenter &&
+		radius == visibleRadius &&
+		tilesVersion == visibleTilesVersion)
+	{
+		return;
+	}
+	visibleCenter = centerCell;
+	visibleRadius = radius;
+	visibleTilesVersion = tilesVersion;
+
+	PairInt32 mapPos;
+	for (mapPos.x = visibleAreaStart.x; mapPos.x < visibleAreaEnd.x; mapPos.x++)
+	{
+		for (mapPos.y = visibleAreaStart.y; mapPos.y < visibleAreaEnd.y; mapPos.y++)
+		{
+			visibleCells.reset(mapPos);
+		}
+	}
+
+	radius = std::max(radius, 0);
+	visibleAreaStart.x = std::max(centerCell.x - radius, 0);
+	visibleAreaStart.y = std::max(centerCell.y - radius, 0);
+	visibleAreaEnd.x = std::min(centerCell.x + radius + 1, mapSizei.x);
+	visibleAreaEnd.y = std::min(centerCell.y + radius + 1, mapSizei.y);
+
+	bool explored = false;
+	auto radiusSquared = radius * radius;
+	for (mapPos.x = visibleAreaStart.x; mapPos.x < visibleAreaEnd.x; mapPos.x++)
+	{
+		for (mapPos.y = visibleAreaStart.y; mapPos.y < visibleAreaEnd.y; mapPos.y++)
+		{
+			auto diffX = mapPos.x - centerCell.x;
+			auto diffY = mapPos.y - centerCell.y;
+			if (diffX * diffX + diffY * diffY > radiusSquared ||
+				hasLineOfSight(centerCell, mapPos) == false)
+			{
+				continue;
+			}
+			visibleCells.set(mapPos);
+			explored |= exploredCells.set(mapPos);
+		}
+	}
+	if (explored == true)
+	{
+		exploredVersion++;
+		exploredAreaStart = visibleAreaStart;
+		exploredAreaEnd = visibleAreaEnd;
+	}
+}
+
 std::vector<PairFloat> LevelMap::getPath(const PairFloat& a, const PairFloat& b) const
 {
 	std::vector<PairFloat> path;
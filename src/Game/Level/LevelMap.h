@@ -1,5 +1,6 @@
 #pragma once
 
+#include "CellBitset.h"
 #include <cstdint>
 #include "FlagsVector.h"
 #include "Game/LightMap.h"
@@ -13,6 +14,8 @@
 #include "Utils/PairXY.h"
 #include <vector>
 
+class LevelObjectManager;
+
 class LevelMap
 {
 private:
@@ -48,6 +51,19 @@ private:
 	std::vector<LightStruct> allLights;
 	static uint32_t maxLights;
 	bool lightsNeedUpdate{ false };
+	uint32_t tilesVersion{ 0 };
+
+	// cells the current player has seen and cells it sees now (in its light radius and line of sight).
+	CellBitset exploredCells;
+	CellBitset visibleCells;
+	PairInt32 visibleCenter{ -1, -1 };
+	int32_t visibleRadius{ -1 };
+	uint32_t visibleTilesVersion{ 0 };
+	PairInt32 visibleAreaStart;
+	PairInt32 visibleAreaEnd;
+	uint32_t exploredVersion{ 0 };
+	PairInt32 exploredAreaStart;
+	PairInt32 exploredAreaEnd;
 
 	static auto& get(int32_t x, int32_t y, const LevelMap& map) { return map.cells[x + y * map.mapSizei.x]; }
 	static auto& get(int32_t x, int32_t y, LevelMap& map) { return map.cells[x + y * map.mapSizei.x]; }
@@ -100,7 +116,7 @@ public:
 	void loadLightMap(const std::string_view fileName);
 	uint8_t getLight(size_t index) const;
 
-	void updateLights(const std::vector<std::shared_ptr<LevelObject>>& levelObjects, const sf::Vector2f& drawCenter);
+	void updateLights(const LevelObjectManager& levelObjects, const sf::Vector2f& drawCenter);
 
 	auto& AllLights() const noexcept { return allLights; }
 
@@ -137,6 +153,25 @@ public:
 	auto DefaultBlockWidth() const noexcept { return defaultBlockWidth; }
 	auto DefaultBlockHeight() const noexcept { return defaultBlockHeight; }
 
+	// changes when the cells' tile indexes are set by resize, clear or the set area functions.
+	auto TilesVersion() const noexcept { return tilesVersion; }
+
+	bool isExplored(const PairInt32& mapPos) const noexcept { return exploredCells.get(mapPos); }
+	bool isVisible(const PairInt32& mapPos) const noexcept { return visibleCells.get(mapPos); }
+
+	auto& ExploredCells() const noexcept { return exploredCells; }
+	void setExploredCells(const std::vector<uint32_t>& runs);
+
+	// changes when cells are explored. the cells explored by the last change
+	// are in [ExploredAreaStart, ExploredAreaEnd).
+	auto ExploredVersion() const noexcept { return exploredVersion; }
+	auto& ExploredAreaStart() const noexcept { return exploredAreaStart; }
+	auto& ExploredAreaEnd() const noexcept { return exploredAreaEnd; }
+
+	// sets the cells seen from center (radius in cells) as visible and explored.
+	// only recomputed if the center cell, the radius or the map's tiles change.
+	void updateVisibleCells(const PairFloat& center, int32_t radius);
+
 	bool isLayerUsed(size_t layer) const noexcept;
 
 	bool isMapCoordValid(int32_t x, int32_t y) const noexcept;
@@ -184,5 +219,13 @@ public:
 
 	std::vector<PairFloat> getPath(const PairFloat& a, const PairFloat& b) const;
 
+	// if another object blocks the next cell of obj's walk path (back), replaces it with a free
+	// neighbour of obj's cell that is also next to the cell after it (sidestep).
+	// returns false if the next cell is blocked and can't be walked around.
+	bool avoidBlockedStep(const LevelObject& obj, std::vector<PairFloat>& walkPath) const;
+
+	// true if no cell between a and b (Bresenham line) blocks the view. ignores level objects.
+	bool hasLineOfSight(const PairInt32& a, const PairInt32& b) const noexcept;
+
 	std::string toCSV(bool zeroBasedIndex) const;
 };
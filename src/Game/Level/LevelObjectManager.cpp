@@ -1,16 +1,20 @@
 #include "LevelObjectManager.h"
+#include "Game/Item/Item.h"
 #include "Game/Player/Player.h"
+#include "Game/Projectile/Projectile.h"
+#include "Game/SimpleLevelObject/SimpleLevelObject.h"
+#include <unordered_map>
 
 void LevelObjectManager::updatePositions(LevelMap& map)
 {
-	for (const auto& obj : levelObjects)
-	{
-		const auto& mapPosition = obj->MapPosition();
-		if (map.isMapCoordValid(mapPosition) == true)
+	forEach([&map](LevelObject& obj)
 		{
-			obj->MapPosition(map, mapPosition);
-		}
-	}
+			const auto& mapPosition = obj.MapPosition();
+			if (map.isMapCoordValid(mapPosition) == true)
+			{
+				obj.MapPosition(map, mapPosition);
+			}
+		});
 }
 
 void LevelObjectManager::add(LevelMap& map, std::shared_ptr<LevelObject> obj)
@@ -30,7 +34,159 @@ void LevelObjectManager::add(LevelMap& map, std::shared_ptr<LevelObject> obj, co
 		levelObjectIds[obj->getId()] = obj;
 	}
 	obj->MapPosition(map, mapCoord);
-	levelObjects.push_back(obj);
+	auto objPtr = obj.get();
+	switch (obj->getObjectType())
+	{
+	case LevelObjectType::Player:
+		updateOrder.push_back(obj);
+		objPtr->handle = players.add(std::move(obj));
+		break;
+	case LevelObjectType::Item:
+		updateOrder.push_back(obj);
+		objPtr->handle = items.add(std::move(obj));
+		break;
+	case LevelObjectType::SimpleLevelObject:
+		updateOrder.push_back(obj);
+		objPtr->handle = simpleLevelObjects.add(std::move(obj));
+		break;
+	case LevelObjectType::Projectile:
+		objPtr->handle = projectiles.add(std::move(obj));
+		break;
+	default:
+		break;
+	}
+}
+
+std::shared_ptr<LevelObject> LevelObjectManager::remove(const LevelObject* obj)
+{
+	if (obj == nullptr)
+	{
+		return nullptr;
+	}
+	auto handle = obj->handle;
+	std::shared_ptr<LevelObject> oldObj;
+	switch (handle.type)
+	{
+	case LevelObjectType::Player:
+		oldObj = players.remove(handle);
+		break;
+	case LevelObjectType::Item:
+		oldObj = items.remove(handle);
+		break;
+	case LevelObjectType::SimpleLevelObject:
+		oldObj = simpleLevelObjects.remove(handle);
+		break;
+	case LevelObjectType::Projectile:
+		oldObj = projectiles.remove(handle);
+		break;
+	default:
+		break;
+	}
+	if (oldObj != nullptr)
+	{
+		oldObj->handle = {};
+		if (oldObj->getId().empty() == false)
+		{
+			levelObjectIds.erase(oldObj->getId());
+		}
+		if (handle.type != LevelObjectType::Projectile)
+		{
+			removeFromUpdateOrder(oldObj.get());
+		}
+	}
+	clearCache(obj);
+	return oldObj;
+}
+
+void LevelObjectManager::removeFromUpdateOrder(const LevelObject* obj)
+{
+	if (updating == true)
+	{
+		removedWhileUpdating.push_back(obj);
+		return;
+	}
+	auto it = std::find_if(updateOrder.begin(), updateOrder.end(), [obj](const auto& updateObj)
+		{
+			return updateObj.get() == obj;
+		});
+	if (it != updateOrder.end())
+	{
+		updateOrder.erase(it);
+	}
+}
+
+void LevelObjectManager::compactUpdateOrder()
+{
+	std::erase_if(updateOrder, [this](const auto& obj)
+		{
+			return get(obj->handle) != obj.get();
+		});
+}
+
+void LevelObjectManager::endUpdate()
+{
+	updating = false;
+	if (removedWhileUpdating.empty() == true)
+	{
+		return;
+	}
+	// an object can be removed and added again while updating,
+	// so only its oldest entries are erased.
+	std::unordered_map<const LevelObject*, size_t> removeCount;
+	for (auto obj : removedWhileUpdating)
+	{
+		removeCount[obj]++;
+	}
+	std::erase_if(updateOrder, [&removeCount](const auto& obj)
+		{
+			auto it = removeCount.find(obj.get());
+			if (it == removeCount.end() || it->second == 0)
+			{
+				return false;
+			}
+			it->second--;
+			return true;
+		});
+	removedWhileUpdating.clear();
+}
+
+LevelObject* LevelObjectManager::get(const LevelObjectHandle& handle) const noexcept
+{
+	switch (handle.type)
+	{
+	case LevelObjectType::Player:
+		return players.get(handle);
+	case LevelObjectType::Item:
+		return items.get(handle);
+	case LevelObjectType::SimpleLevelObject:
+		return simpleLevelObjects.get(handle);
+	case LevelObjectType::Projectile:
+		return projectiles.get(handle);
+	default:
+		return nullptr;
+	}
+}
+
+std::shared_ptr<Projectile> LevelObjectManager::makeProjectile(const Spell* spell)
+{
+	if (projectilePool.empty() == false)
+	{
+		auto projectile = std::move(projectilePool.back());
+		projectilePool.pop_back();
+		return projectile;
+	}
+	return std::make_shared<Projectile>(spell);
+}
+
+void LevelObjectManager::releaseProjectile(LevelMap& map, Projectile& projectile)
+{
+	projectile.remove(map);
+	auto obj = remove<Projectile>(&projectile);
+	// only reuse it if no one else holds it.
+	if (obj != nullptr && obj.use_count() == 1)
+	{
+		projectilePool.push_back(std::move(obj));
+	}
 }
 
 void LevelObjectManager::clearCache(const LevelObject* obj) noexcept
@@ -55,57 +211,51 @@ void LevelObjectManager::deleteById(LevelMap& map, const std::string_view id)
 	{
 		return;
 	}
-	for (auto it = levelObjects.begin(); it != levelObjects.end(); ++it)
+	auto it = levelObjectIds.find(id);
+	if (it != levelObjectIds.end())
 	{
-		if ((*it)->getId() == id)
-		{
-			auto obj = it->get();
-			obj->remove(map);
-			clearCache(obj);
-			if (obj->getId().empty() == false)
-			{
-				levelObjectIds.erase(obj->getId());
-			}
-			levelObjects.erase(it);
-			break;
-		}
+		auto obj = it->second;
+		obj->remove(map);
+		remove(obj.get());
 	}
 }
 
 void LevelObjectManager::deleteByClass(LevelMap& map, const std::string_view classId)
 {
-	if (classId.empty() == true)
+	auto obj = getByClass(classId);
+	if (obj != nullptr)
 	{
-		return;
-	}
-	for (auto it = levelObjects.begin(); it != levelObjects.end(); ++it)
-	{
-		if ((*it)->getClassId() == classId)
-		{
-			auto obj = it->get();
-			obj->remove(map);
-			clearCache(obj);
-			if (obj->getId().empty() == false)
-			{
-				levelObjectIds.erase(obj->getId());
-			}
-			levelObjects.erase(it);
-			break;
-		}
+		obj->remove(map);
+		remove(obj);
 	}
 }
 
 void LevelObjectManager::clearAll(LevelMap& map)
 {
-	for (const auto& obj : levelObjects)
+	forEach([&map](LevelObject& obj)
+		{
+			const auto& mapPos = obj.MapPosition();
+			if (map.isMapCoordValid(mapPos) == true)
+			{
+				map[mapPos].removeObject(&obj);
+			}
+			obj.handle = {};
+		});
+	if (updating == true)
 	{
-		const auto& mapPos = obj->MapPosition();
-		if (map.isMapCoordValid(mapPos) == true)
+		for (const auto& obj : updateOrder)
 		{
-			map[mapPos].removeObject(obj.get());
+			removedWhileUpdating.push_back(obj.get());
 		}
 	}
-	levelObjects.clear();
+	else
+	{
+		updateOrder.clear();
+	}
+	players.clear();
+	items.clear();
+	simpleLevelObjects.clear();
+	projectiles.clear();
 	levelObjectIds.clear();
 }
 
@@ -143,14 +293,17 @@ LevelObject* LevelObjectManager::getByClass(const std::string_view classId) cons
 	{
 		return nullptr;
 	}
-	for (const auto& obj : levelObjects)
-	{
-		if (obj->getClassId() == classId)
+	LevelObject* classObj = nullptr;
+	anyOf([&classId, &classObj](LevelObject& obj)
 		{
-			return obj.get();
-		}
-	}
-	return nullptr;
+			if (obj.getClassId() == classId)
+			{
+				classObj = &obj;
+				return true;
+			}
+			return false;
+		});
+	return classObj;
 }
 
 std::shared_ptr<LevelObject> LevelObjectManager::getByQueryId(const std::string_view id) const
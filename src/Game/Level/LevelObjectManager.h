@@ -3,10 +3,17 @@
 #include "Game/Classifier.h"
 #include "Game/LevelObject/LevelObject.h"
 #include "Game/LevelObject/LevelObjectClass.h"
+#include <deque>
 #include "LevelMap.h"
+#include "LevelObjectSlotMap.h"
+#include <type_traits>
 #include "Utils/UnorderedStringMap.h"
 
+class Item;
 class Player;
+class Projectile;
+class SimpleLevelObject;
+class Spell;
 
 class LevelObjectManager
 {
@@ -14,7 +21,23 @@ private:
 	friend class Level;
 	friend class LevelItem;
 
-	std::vector<std::shared_ptr<LevelObject>> levelObjects;
+	// level objects are stored by concrete type, so lookups and removals don't need casts.
+	LevelObjectSlotMap<Player> players{ LevelObjectType::Player };
+	LevelObjectSlotMap<Item> items{ LevelObjectType::Item };
+	LevelObjectSlotMap<SimpleLevelObject> simpleLevelObjects{ LevelObjectType::SimpleLevelObject };
+	LevelObjectSlotMap<Projectile> projectiles{ LevelObjectType::Projectile };
+
+	// players, items and simple objects in the order they were added to the level,
+	// which is the order they're updated in. a deque, so objects added while updating
+	// don't move the entries of the objects being updated.
+	std::deque<std::shared_ptr<LevelObject>> updateOrder;
+	// objects removed while updating. they're erased from updateOrder in endUpdate.
+	std::vector<const LevelObject*> removedWhileUpdating;
+	bool updating{ false };
+
+	// expired projectiles, reused by makeProjectile.
+	std::vector<std::shared_ptr<Projectile>> projectilePool;
+
 	UnorderedStringMap<std::shared_ptr<LevelObject>> levelObjectIds;
 
 	std::weak_ptr<LevelObject> clickedObject;
@@ -26,30 +49,72 @@ private:
 
 	void add(LevelMap& map, std::shared_ptr<LevelObject> obj, const PairFloat& mapCoord);
 
+	// while updating, removed objects stay in the update order (and alive) until endUpdate.
+	void beginUpdate() noexcept { updating = true; }
+	void endUpdate();
+
+	void removeFromUpdateOrder(const LevelObject* obj);
+
+	// erases the objects that are no longer in the level from the update order.
+	void compactUpdateOrder();
+
 	// clears the clickedObject, hoverObject, currentPlayer if they're pointing to the given object.
 	void clearCache(const LevelObject* obj) noexcept;
 
+	// Removes level object from level. Object still needs to be deleted from map.
+	// Returns the removed object.
+	std::shared_ptr<LevelObject> remove(const LevelObject* obj);
+
 	// Removes level object from level. Object still needs to be deleted from map.
 	// Returns the removed object.
 	template <class T>
 	std::shared_ptr<T> remove(const LevelObject* obj)
 	{
-		std::shared_ptr<T> oldObj;
-		for (auto it = levelObjects.begin(); it != levelObjects.end(); ++it)
+		return std::static_pointer_cast<T>(remove(obj));
+	}
+
+	// Removes all objects of the store from the level and the map, except the excluded ids.
+	template <class T>
+	void clear(LevelObjectSlotMap<T>& store, LevelMap& map, const std::vector<std::string>& excludeIds)
+	{
+		size_t i = 0;
+		while (i < store.size())
 		{
-			if (it->get() == obj)
+			auto obj = store[i].get();
+			if (excludeIds.empty() == false &&
+				std::find(excludeIds.begin(), excludeIds.end(), obj->getId()) != excludeIds.end())
+			{
+				i++;
+				continue;
+			}
+			const auto& mapPos = obj->MapPosition();
+			if (map.isMapCoordValid(mapPos) == true)
 			{
-				oldObj = std::move(std::dynamic_pointer_cast<T>(*it));
-				if (oldObj->getId().empty() == false)
+				map[mapPos].removeObject(obj);
+			}
+			if (obj->getId().empty() == false)
+			{
+				levelObjectIds.erase(obj->getId());
+			}
+			clearCache(obj);
+			if constexpr (std::is_same_v<T, Projectile> == false)
+			{
+				if (updating == true)
 				{
-					levelObjectIds.erase(oldObj->getId());
+					removedWhileUpdating.push_back(obj);
 				}
-				levelObjects.erase(it);
-				break;
+			}
+			auto handle = obj->handle;
+			obj->handle = {};
+			store.remove(handle);
+		}
+		if constexpr (std::is_same_v<T, Projectile> == false)
+		{
+			if (updating == false)
+			{
+				compactUpdateOrder();
 			}
 		}
-		clearCache(obj);
-		return oldObj;
 	}
 
 	template <class T>
@@ -59,15 +124,11 @@ private:
 		{
 			if (dynamic_cast<T*>(it->second.get()) != nullptr)
 			{
-				bool classBeingUsed = false;
-				for (const auto& obj : levelObjects)
-				{
-					if (obj->getBaseClass() == it->second.get())
+				auto classObj = it->second.get();
+				bool classBeingUsed = anyOf([classObj](LevelObject& obj)
 					{
-						classBeingUsed = true;
-						break;
-					}
-				}
+						return obj.getBaseClass() == classObj;
+					});
 				if (classBeingUsed == false)
 				{
 					it = levelObjectClasses.erase(it);
@@ -79,10 +140,50 @@ private:
 	}
 
 public:
-	auto& Objects() const { return levelObjects; }
+	auto& Players() const noexcept { return players; }
+	auto& Items() const noexcept { return items; }
+	auto& SimpleLevelObjects() const noexcept { return simpleLevelObjects; }
+	auto& Projectiles() const noexcept { return projectiles; }
 	auto& ObjectIds() const { return levelObjectIds; }
 	auto& Classes() const { return levelObjectClasses; }
 
+	auto size() const noexcept
+	{
+		return players.size() + items.size() + simpleLevelObjects.size() + projectiles.size();
+	}
+
+	// calls fn(LevelObject&) for every level object, grouped by type.
+	template <class Fn>
+	void forEach(Fn fn) const
+	{
+		for (const auto& obj : players) { fn(*obj); }
+		for (const auto& obj : items) { fn(*obj); }
+		for (const auto& obj : simpleLevelObjects) { fn(*obj); }
+		for (const auto& obj : projectiles) { fn(*obj); }
+	}
+
+	// returns true if pred(LevelObject&) is true for any level object.
+	template <class Pred>
+	bool anyOf(Pred pred) const
+	{
+		for (const auto& obj : players) { if (pred(*obj) == true) return true; }
+		for (const auto& obj : items) { if (pred(*obj) == true) return true; }
+		for (const auto& obj : simpleLevelObjects) { if (pred(*obj) == true) return true; }
+		for (const auto& obj : projectiles) { if (pred(*obj) == true) return true; }
+		return false;
+	}
+
+	// Projectiles
+
+	// returns an expired projectile from the pool or a new one. it still needs to be initialized and added.
+	std::shared_ptr<Projectile> makeProjectile(const Spell* spell);
+
+	// removes the projectile from the level and the map and returns it to the pool.
+	void releaseProjectile(LevelMap& map, Projectile& projectile);
+
+	// get level object by handle. Returns null if the handle is no longer valid.
+	LevelObject* get(const LevelObjectHandle& handle) const noexcept;
+
 	auto hasClickedObject() const noexcept { return clickedObject.expired() == false; }
 	auto ClickedObject() const noexcept { return clickedObject.lock(); }
 	void ClickedObject(std::weak_ptr<LevelObject> object) noexcept { clickedObject = object; }
@@ -114,55 +215,29 @@ public:
 	template <class T>
 	void clear(LevelMap& map)
 	{
-		auto it = levelObjects.begin();
-		while (it != levelObjects.end())
-		{
-			if (dynamic_cast<T*>(it->get()) != nullptr)
-			{
-				const auto& mapPos = (*it)->MapPosition();
-				if (map.isMapCoordValid(mapPos) == true)
-				{
-					map[mapPos].removeObject(it->get());
-				}
-				if ((*it)->getId().empty() == false)
-				{
-					levelObjectIds.erase((*it)->getId());
-				}
-				clearCache(it->get());
-				it = levelObjects.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
+		clear<T>(map, {});
 	}
 
+	// Removes all objects of type T (Player, Item, SimpleLevelObject, Projectile or LevelObject for all)
+	// from the level and the map, except the excluded ids.
 	template <class T>
 	void clear(LevelMap& map, const std::vector<std::string>& excludeIds)
 	{
-		auto it = levelObjects.begin();
-		while (it != levelObjects.end())
+		if constexpr (std::is_same_v<T, Player> || std::is_same_v<T, LevelObject>)
 		{
-			if (dynamic_cast<T*>(it->get()) != nullptr
-				&& std::find(excludeIds.begin(), excludeIds.end(),
-				(*it)->getId()) == excludeIds.end())
-			{
-				const auto& mapPos = (*it)->MapPosition();
-				if (map.isMapCoordValid(mapPos) == true)
-				{
-					map[mapPos].removeObject(it->get());
-				}
-				if ((*it)->getId().empty() == false)
-				{
-					levelObjectIds.erase((*it)->getId());
-				}
-				it = levelObjects.erase(it);
-			}
-			else
-			{
-				++it;
-			}
+			clear(players, map, excludeIds);
+		}
+		if constexpr (std::is_same_v<T, Item> || std::is_same_v<T, LevelObject>)
+		{
+			clear(items, map, excludeIds);
+		}
+		if constexpr (std::is_same_v<T, SimpleLevelObject> || std::is_same_v<T, LevelObject>)
+		{
+			clear(simpleLevelObjects, map, excludeIds);
+		}
+		if constexpr (std::is_same_v<T, Projectile> || std::is_same_v<T, LevelObject>)
+		{
+			clear(projectiles, map, excludeIds);
 		}
 	}
 
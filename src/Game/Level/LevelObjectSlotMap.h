@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include "Game/LevelObject/LevelObjectHandle.h"
+#include <memory>
+#include <vector>
+
+class LevelObject;
+
+// Stores level objects of a single concrete type in a dense array.
+// Objects are referenced by generational handles that stay stable while
+// other objects are added or removed. Removal is O(1) (swap with last),
+// so the dense order isn't the insertion order (see getInsertionOrder).
+// Objects are kept as shared pointers because items move between the level
+// and inventories and scripts keep weak references (hover, clicked, etc).
+template <class T>
+class LevelObjectSlotMap
+{
+private:
+	struct Slot
+	{
+		uint32_t denseIndex{ LevelObjectHandle::InvalidIndex };
+		uint32_t generation{ 0 };
+	};
+
+	std::vector<std::shared_ptr<LevelObject>> objects;
+	std::vector<uint32_t> denseToSlot;
+	// insertion number of each dense object.
+	std::vector<uint64_t> denseToOrder;
+	std::vector<Slot> slots;
+	std::vector<uint32_t> freeSlots;
+	uint64_t nextOrder{ 0 };
+	LevelObjectType type;
+
+public:
+	LevelObjectSlotMap(LevelObjectType type_) noexcept : type(type_) {}
+
+	auto begin() const noexcept { return objects.begin(); }
+	auto end() const noexcept { return objects.end(); }
+	auto cbegin() const noexcept { return objects.cbegin(); }
+	auto cend() const noexcept { return objects.cend(); }
+
+	auto size() const noexcept { return objects.size(); }
+	bool empty() const noexcept { return objects.empty(); }
+
+	// returns the shared pointer at the dense index.
+	auto& operator[](size_t idx) const noexcept { return objects[idx]; }
+
+	// returns the typed object at the dense index.
+	T* at(size_t idx) const noexcept { return static_cast<T*>(objects[idx].get()); }
+
+	bool contains(const LevelObjectHandle& handle) const noexcept
+	{
+		return handle.type == type &&
+			handle.index < slots.size() &&
+			slots[handle.index].generation == handle.generation &&
+			slots[handle.index].denseIndex != LevelObjectHandle::InvalidIndex;
+	}
+
+	T* get(const LevelObjectHandle& handle) const noexcept
+	{
+		if (contains(handle) == false)
+		{
+			return nullptr;
+		}
+		return at(slots[handle.index].denseIndex);
+	}
+
+	const std::shared_ptr<LevelObject>* getSharedPtr(const LevelObjectHandle& handle) const noexcept
+	{
+		if (contains(handle) == false)
+		{
+			return nullptr;
+		}
+		return &objects[slots[handle.index].denseIndex];
+	}
+
+	LevelObjectHandle add(std::shared_ptr<LevelObject> obj)
+	{
+		uint32_t slotIdx;
+		if (freeSlots.empty() == false)
+		{
+			slotIdx = freeSlots.back();
+			freeSlots.pop_back();
+		}
+		else
+		{
+			slotIdx = (uint32_t)slots.size();
+			slots.push_back({});
+		}
+		auto& slot = slots[slotIdx];
+		slot.denseIndex = (uint32_t)objects.size();
+		objects.push_back(std::move(obj));
+		denseToSlot.push_back(slotIdx);
+		denseToOrder.push_back(nextOrder++);
+		return { slotIdx, slot.generation, type };
+	}
+
+	// Removes the object referenced by the handle and returns it.
+	// The last object takes the removed object's place in the dense array.
+	std::shared_ptr<LevelObject> remove(const LevelObjectHandle& handle)
+	{
+		if (contains(handle) == false)
+		{
+			return nullptr;
+		}
+		auto& slot = slots[handle.index];
+		auto denseIdx = slot.denseIndex;
+		auto lastIdx = (uint32_t)objects.size() - 1;
+
+		auto oldObj = std::move(objects[denseIdx]);
+		if (denseIdx != lastIdx)
+		{
+			objects[denseIdx] = std::move(objects[lastIdx]);
+			denseToSlot[denseIdx] = denseToSlot[lastIdx];
+			denseToOrder[denseIdx] = denseToOrder[lastIdx];
+			slots[denseToSlot[denseIdx]].denseIndex = denseIdx;
+		}
+		objects.pop_back();
+		denseToSlot.pop_back();
+		denseToOrder.pop_back();
+
+		slot.denseIndex = LevelObjectHandle::InvalidIndex;
+		slot.generation++;
+		freeSlots.push_back(handle.index);
+		return oldObj;
+	}
+
+	void clear()
+	{
+		for (uint32_t i = 0; i < (uint32_t)slots.size(); i++)
+		{
+			if (slots[i].denseIndex != LevelObjectHandle::InvalidIndex)
+			{
+				slots[i].denseIndex = LevelObjectHandle::InvalidIndex;
+				slots[i].generation++;
+				freeSlots.push_back(i);
+			}
+		}
+		objects.clear();
+		denseToSlot.clear();
+		denseToOrder.clear();
+	}
+
+	// dense indexes in the order the objects were added (used when saving).
+	std::vector<size_t> getInsertionOrder() const
+	{
+		std::vector<size_t> indexes(objects.size());
+		for (size_t i = 0; i < indexes.size(); i++)
+		{
+			indexes[i] = i;
+		}
+		std::sort(indexes.begin(), indexes.end(), [this](size_t a, size_t b)
+			{
+				return denseToOrder[a] < denseToOrder[b];
+			});
+		return indexes;
+	}
+};
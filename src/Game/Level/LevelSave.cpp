@@ -3,6 +3,7 @@
 #include "Game/Player/Player.h"
 #include "Game/SimpleLevelObject/SimpleLevelObject.h"
 #include "Game/Utils/FileUtils.h"
+#include "Game/Utils/GameUtils.h"
 #include "Json/JsonParser.h"
 #include "Json/SaveUtils.h"
 
@@ -80,6 +81,21 @@ void LevelSave::serialize(const Level& level, void* serializeObj, const Unordere
 	// map
 	writer.EndObject();
 
+	auto exploredRuns = level.map.ExploredCells().getRuns();
+	if (exploredRuns.empty() == false)
+	{
+		// run lengths of unexplored and explored cells
+		writeKeyStringView(writer, "exploredCells");
+		writer.SetFormatOptions(PrettyFormatOptions::kFormatSingleLineArray);
+		writer.StartArray();
+		for (auto run : exploredRuns)
+		{
+			writer.Uint(run);
+		}
+		writer.EndArray();
+		writer.SetFormatOptions(PrettyFormatOptions::kFormatDefault);
+	}
+
 	// level
 	writer.EndObject();
 
@@ -98,45 +114,52 @@ void LevelSave::serialize(const Level& level, void* serializeObj, const Unordere
 		writer.EndArray();
 	}
 
-	writeKeyStringView(writer, "item");
-	writer.StartArray();
-	for (const auto& obj : level.levelObjects.Objects())
+	// only for game saves. level changes save and reload the level,
+	// which would rewind the streams.
+	if (getBoolProperty(props, "saveRandom") == true)
 	{
-		auto item = dynamic_cast<Item*>(obj.get());
-		if (item != nullptr)
+		writeKeyStringView(writer, "random");
+		writer.StartArray();
+		for (size_t i = 0; i < (size_t)RandomStream::Size; i++)
 		{
-			item->serialize(level, serializeObj, props);
+			auto stream = (RandomStream)i;
+			writer.StartObject();
+			writeStringView(writer, "stream", GameUtils::getRandomStreamName(stream));
+			writeUInt64(writer, "seed", Random::getSeed(stream));
+			writeUInt64(writer, "state", Random::getState(stream));
+			writer.EndObject();
 		}
+		writer.EndArray();
+	}
+
+	writeKeyStringView(writer, "item");
+	writer.StartArray();
+	for (auto i : level.levelObjects.Items().getInsertionOrder())
+	{
+		level.levelObjects.Items().at(i)->serialize(level, serializeObj, props);
 	}
 	writer.EndArray();
 
 	writeKeyStringView(writer, "levelObject");
 	writer.StartArray();
-	for (const auto& obj : level.levelObjects.Objects())
+	for (auto i : level.levelObjects.SimpleLevelObjects().getInsertionOrder())
 	{
-		auto levelObj = dynamic_cast<SimpleLevelObject*>(obj.get());
-		if (levelObj != nullptr)
-		{
-			levelObj->serialize(level, serializeObj, props);
-		}
+		level.levelObjects.SimpleLevelObjects().at(i)->serialize(level, serializeObj, props);
 	}
 	writer.EndArray();
 
 	writeKeyStringView(writer, "player");
 	writer.StartArray();
 	auto currentPlayer = level.levelObjects.CurrentPlayer();
-	for (const auto& obj : level.levelObjects.Objects())
+	for (auto i : level.levelObjects.Players().getInsertionOrder())
 	{
-		auto player = dynamic_cast<Player*>(obj.get());
-		if (player != nullptr)
+		auto player = level.levelObjects.Players().at(i);
+		if (getBoolProperty(props, "saveCurrentPlayer") == false &&
+			player == currentPlayer.get())
 		{
-			if (getBoolProperty(props, "saveCurrentPlayer") == false &&
-				player == currentPlayer.get())
-			{
-				continue;
-			}
-			player->serialize(level, serializeObj, props);
+			continue;
 		}
+		player->serialize(level, serializeObj, props);
 	}
 	writer.EndArray();
 
@@ -100,6 +100,15 @@ bool LevelUIObject::getProperty(const Level& level, const std::string_view prop,
 	case str2int16("id"):
 		var = Variable(level.id);
 		return true;
+	case str2int16("isExplored"):
+	case str2int16("isVisible"):
+	{
+		auto mapPos = Utils::splitStringIn2(props.second, ',');
+		PairInt32 mapCoord(Utils::strtou(mapPos.first), Utils::strtou(mapPos.second));
+		var = Variable(propHash == str2int16("isExplored") ?
+			level.map.isExplored(mapCoord) : level.map.isVisible(mapCoord));
+		return true;
+	}
 	case str2int16("name"):
 		var = Variable(level.name);
 		return true;
@@ -148,6 +157,12 @@ bool LevelUIObject::getProperty(const Level& level, const std::string_view prop,
 		}
 		break;
 	}
+	case str2int16("exploredCells"):
+		var = Variable((int64_t)level.map.ExploredCells().count());
+		return true;
+	case str2int16("frameMismatches"):
+		var = Variable((int64_t)level.frameMismatches);
+		return true;
 	case str2int16("showAutomap"):
 		var = Variable(level.automapSurface.visible);
 		return true;
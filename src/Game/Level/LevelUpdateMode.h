@@ -0,0 +1,15 @@
+#pragma once
+
+// how the first update phase (LevelObject::updateFrame) runs.
+enum class LevelUpdateMode
+{
+	// no first phase. objects step their animation in update, after their queued actions.
+	Serial,
+	// objects step their animation in parallel before any update runs.
+	Parallel,
+	// runs the first phase in parallel, rewinds it, runs it serially and counts the
+	// objects whose frame state differs. it only checks that the parallel first phase
+	// is thread safe, it doesn't compare the frame with a Serial mode frame
+	// (which steps animations after the queued actions).
+	VerifyFrames
+};
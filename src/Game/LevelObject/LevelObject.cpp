@@ -96,7 +96,7 @@ PairFloat LevelObject::getCenterMapPosition(const PairFloat& mapPos)
 	return minMapPosition;
 }
 
-void LevelObject::getMinMaxMapPosition(const PairFloat& mapPos, PairFloat& minMapPos, PairFloat& maxMapPos)
+void LevelObject::getMinMaxMapPosition(const PairFloat& mapPos, PairFloat& minMapPos, PairFloat& maxMapPos) const
 {
 	minMapPos = mapPos;
 	maxMapPos = mapPos;
@@ -118,32 +118,27 @@ void LevelObject::getMinMaxMapPosition(const PairFloat& mapPos, PairFloat& minMa
 	}
 }
 
+bool LevelObject::hitTest(const PairFloat& mapPos) const
+{
+	PairFloat minMapPosition;
+	PairFloat maxMapPosition;
+	getMinMaxMapPosition(mapPosition, minMapPosition, maxMapPosition);
+
+	return (mapPos.x <= maxMapPosition.x &&
+		mapPos.x >= minMapPosition.x &&
+		mapPos.y <= maxMapPosition.y &&
+		mapPos.y >= minMapPosition.y);
+}
+
 void LevelObject::updateHover(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr)
 {
 	if (enableHover == false || level.EnableHover() == false)
 	{
 		return;
 	}
-	bool objHovered = level.HasMouseInside() == true;
-	if (cellSize.x == 0 || cellSize.y == 0)
-	{
-		objHovered = objHovered &&
-			(sprite.getGlobalBounds().contains(level.MousePositionf()) == true);
-	}
-	else
-	{
-		PairFloat minMapPosition;
-		PairFloat maxMapPosition;
-		getMinMaxMapPosition(mapPosition, minMapPosition, maxMapPosition);
-
-		auto mouseMapCoord = level.getMapCoordOverMouse();
-
-		objHovered = objHovered &&
-			(mouseMapCoord.x <= maxMapPosition.x &&
-				mouseMapCoord.x >= minMapPosition.x &&
-				mouseMapCoord.y <= maxMapPosition.y &&
-				mouseMapCoord.y >= minMapPosition.y);
-	}
+	// the level resolves the top-most object under the mouse once per frame.
+	bool objHovered = handle.isValid() == true &&
+		level.HoverObjectHandle() == handle;
 	if (objHovered == true)
 	{
 		if (level.LevelObjects().hasClickedObject() == false)
@@ -237,6 +232,32 @@ bool LevelObject::updateMapPositionFront(LevelMap& map, const PairFloat pos)
 	return success;
 }
 
+LevelObjectFrameState LevelObject::getFrameState() const
+{
+	LevelObjectFrameState state;
+	state.currentTextureIdx = animation.currentTextureIdx;
+	state.animationTime = animation.elapsedTime.currentTime;
+	state.backDirection = animation.backDirection;
+	state.frameUpdated = frameUpdated;
+	state.basePosition = basePosition;
+	state.anchorPosition = anchorPosition;
+	state.drawPosition = sprite.getPosition();
+	state.tileBlockHeight = tileBlockHeight;
+	return state;
+}
+
+void LevelObject::setFrameState(const LevelObjectFrameState& state)
+{
+	animation.currentTextureIdx = state.currentTextureIdx;
+	animation.elapsedTime.currentTime = state.animationTime;
+	animation.backDirection = state.backDirection;
+	frameUpdated = state.frameUpdated;
+	basePosition = state.basePosition;
+	anchorPosition = state.anchorPosition;
+	tileBlockHeight = state.tileBlockHeight;
+	updateSpriteDrawPosition();
+}
+
 bool LevelObject::updateTexture()
 {
 	if (animation.updateTexture(sprite, absoluteOffset) == true)
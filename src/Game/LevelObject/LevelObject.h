@@ -3,6 +3,7 @@
 #include "Game/BaseAnimation.h"
 #include "Game/Variable.h"
 #include "LevelObjectClass.h"
+#include "LevelObjectHandle.h"
 #include "LevelObjectQueryable.h"
 #include <list>
 #include <memory>
@@ -14,8 +15,31 @@ class Game;
 class Level;
 class LevelMap;
 
+// the state changed by LevelObject::updateFrame. used to compare parallel and serial updates.
+struct LevelObjectFrameState
+{
+	uint32_t currentTextureIdx{ 0 };
+	sf::Time animationTime;
+	bool backDirection{ false };
+	bool frameUpdated{ false };
+	sf::Vector2f basePosition;
+	sf::Vector2f anchorPosition;
+	sf::Vector2f drawPosition;
+	float tileBlockHeight{ 0.f };
+
+	bool operator==(const LevelObjectFrameState&) const = default;
+};
+
 class LevelObject : public LevelObjectQueryable
 {
+private:
+	friend class LevelObjectManager;
+
+	LevelObjectType objectType{ LevelObjectType::Unknown };
+
+	// set by the LevelObjectManager when the object is added to a level
+	LevelObjectHandle handle;
+
 protected:
 	const LevelObjectClass* class_{ nullptr };
 
@@ -27,6 +51,11 @@ protected:
 	PairFloat mapPosition{ -1.f, -1.f };
 
 	BaseAnimation animation;
+	// set by updateFrame when the animation advanced, consumed by update.
+	bool frameUpdated{ false };
+	// true if updateFrame stepped the animation this frame.
+	// if not (serial update mode), update steps it itself.
+	bool frameStepped{ false };
 	LightSource lightSource;
 	PairInt8 cellSize;
 
@@ -43,7 +72,7 @@ protected:
 
 	PairFloat getCenterMapPosition(const PairFloat& mapPos);
 
-	void getMinMaxMapPosition(const PairFloat& mapPos, PairFloat& minMapPos, PairFloat& maxMapPos);
+	void getMinMaxMapPosition(const PairFloat& mapPos, PairFloat& minMapPos, PairFloat& maxMapPos) const;
 
 	bool hasValidState() const noexcept;
 	bool getCurrentTexture(TextureInfo& ti) const;
@@ -62,7 +91,8 @@ protected:
 	void MapPosition(const PairFloat& pos) noexcept { mapPosition = pos; }
 
 public:
-	LevelObject(const LevelObjectClass* class__) : class_(class__) {}
+	LevelObject(const LevelObjectClass* class__, LevelObjectType objectType_)
+		: objectType(objectType_), class_(class__) {}
 	~LevelObject() override = default;
 
 	auto& getBasePosition() const noexcept { return basePosition; }
@@ -71,6 +101,7 @@ public:
 
 	auto& Position() const { return sprite.getPosition(); }
 	auto Size() const { return sprite.getSize(); }
+	auto getGlobalBounds() const { return sprite.getGlobalBounds(); }
 	auto& MapPosition() const noexcept { return mapPosition; }
 
 	// removes this object from the map
@@ -88,6 +119,11 @@ public:
 
 	virtual const std::string_view getType() const = 0;
 
+	auto getObjectType() const noexcept { return objectType; }
+
+	// handle in the level this object belongs to. Invalid if not in a level.
+	auto& Handle() const noexcept { return handle; }
+
 	auto getDefaultLight() const noexcept { return class_->getLightSource().light; }
 	auto getDefaultLightSource() const noexcept { return class_->getLightSource(); }
 
@@ -114,6 +150,9 @@ public:
 	auto getBaseClass() const { return class_; }
 
 	auto getCellSize() const noexcept { return cellSize; }
+
+	// true if mapPos is inside the cells this object occupies.
+	bool hitTest(const PairFloat& mapPos) const;
 	void setCellSize(PairInt8 cellSize_) noexcept { cellSize = cellSize_; }
 
 	auto& getId() const { return id; }
@@ -124,7 +163,15 @@ public:
 		sprite.draw(target, spriteShader, cache);
 	}
 
+	// first update phase. only changes this object (animation and draw position),
+	// so it can run for all the level's objects in parallel.
+	virtual void updateFrame(sf::Time elapsedTime, const LevelMap& map) {}
+
+	// second update phase. runs serially and can change the level and other objects.
 	virtual void update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr) = 0;
 
+	LevelObjectFrameState getFrameState() const;
+	void setFrameState(const LevelObjectFrameState& state);
+
 	bool getTexture(uint32_t textureNumber, TextureInfo& ti) const override;
 };
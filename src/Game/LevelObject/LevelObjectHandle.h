@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+enum class LevelObjectType : uint8_t
+{
+	Unknown,
+	Player,
+	Item,
+	SimpleLevelObject,
+	Projectile
+};
+
+// type tag of T if it declares a static ObjectType, Unknown otherwise.
+template <class T>
+constexpr LevelObjectType getLevelObjectType() noexcept
+{
+	if constexpr (requires { T::ObjectType; })
+	{
+		return T::ObjectType;
+	}
+	else
+	{
+		return LevelObjectType::Unknown;
+	}
+}
+
+// Generational handle to a level object stored in a level.
+// Handles are invalidated when the object is removed from the level,
+// even if the slot is later reused by another object.
+struct LevelObjectHandle
+{
+	static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+	uint32_t index{ InvalidIndex };
+	uint32_t generation{ 0 };
+	LevelObjectType type{ LevelObjectType::Unknown };
+
+	constexpr bool isValid() const noexcept { return index != InvalidIndex; }
+
+	constexpr bool operator==(const LevelObjectHandle& other) const noexcept = default;
+};
@@ -1,27 +1,29 @@
 #include "Player.h"
 #include "Game/Game.h"
 #include "Game/Level/Level.h"
+#include "PlayerAI.h"
+#include "PlayerCombat.h"
 #include "PlayerMove.h"
 
-void Player::updateAI(Level& level)
+void Player::updateAI(Game& game, Level& level)
 {
-	switch (playerStatus)
-	{
-	case PlayerStatus::Walk:
-		return;
-	default:
-		break;
-	}
-	auto plr = level.LevelObjects().CurrentPlayer();
-	if (plr != nullptr)
-	{
-		setWalkPath(level.Map().getPath(mapPosition, plr->MapPosition()), false);
-	}
+	PlayerAI::update(*this, game, level);
 }
 
 void Player::updateAnimation(const Game& game)
 {
-	if (animation.update(game.getElapsedTime()))
+	bool updated = false;
+	if (frameStepped == true)
+	{
+		frameStepped = false;
+		updated = frameUpdated;
+	}
+	else
+	{
+		updated = animation.update(game.getElapsedTime());
+	}
+	frameUpdated = false;
+	if (updated == true)
 	{
 		updateTexture();
 	}
@@ -29,13 +31,20 @@ void Player::updateAnimation(const Game& game)
 
 void Player::updateWalk(Game& game, Level& level)
 {
-	PlayerMove::updateWalkPath(*this, game, level.Map());
+	PlayerMove::updateWalkPath(*this, game, level);
 	updateAnimation(game);
 }
 
-void Player::updateAttack(Game& game, Level& level)
+void Player::updateAttack(Game& game, const std::shared_ptr<LevelObject>& thisPtr)
 {
 	updateAnimation(game);
+	PlayerCombat::updateAttack(*this, thisPtr);
+}
+
+void Player::updateHit(Game& game)
+{
+	updateAnimation(game);
+	PlayerCombat::updateHit(*this);
 }
 
 void Player::updateDead(Game& game, Level& level)
@@ -52,6 +61,33 @@ void Player::updateDead(Game& game, Level& level)
 	updateAnimation(game);
 }
 
+void Player::updateFrame(sf::Time elapsedTime, const LevelMap& map)
+{
+	frameUpdated = false;
+	frameStepped = false;
+	if (hasValidState() == false)
+	{
+		return;
+	}
+	switch (playerStatus)
+	{
+	case PlayerStatus::Walk:
+		// walking changes the animation while moving on the map, so it's stepped in update.
+		return;
+	case PlayerStatus::Dead:
+		if (playerAnimation != PlayerAnimation::Die1 ||
+			animation.currentTextureIdx >= animation.textureIndexRange.second)
+		{
+			return;
+		}
+		break;
+	default:
+		break;
+	}
+	frameUpdated = animation.update(elapsedTime);
+	frameStepped = true;
+}
+
 void Player::update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr)
 {
 	processQueuedActions(game);
@@ -62,14 +98,17 @@ void Player::update(Game& game, Level& level, const std::shared_ptr<LevelObject>
 	}
 	if (aiType != 0)
 	{
-		updateAI(level);
+		updateAI(game, level);
 	}
 
+	PlayerCombat::applyQueuedDamage(*this);
+
 	if (playerStatus != PlayerStatus::Dead &&
 		properties.LifeNow() <= 0)
 	{
 		playerStatus = PlayerStatus::Dead;
-		playSound("die");
+		playSound(game, "die", 0, 1);
+		PlayerCombat::onDeath(*this, game, level);
 	}
 
 	switch (playerStatus)
@@ -82,12 +121,16 @@ void Player::update(Game& game, Level& level, const std::shared_ptr<LevelObject>
 		updateWalk(game, level);
 		break;
 	case PlayerStatus::Attack:
-		updateAttack(game, level);
+		updateAttack(game, thisPtr);
+		break;
+	case PlayerStatus::Hit:
+		updateHit(game);
 		break;
 	case PlayerStatus::Dead:
 		updateDead(game, level);
 		break;
 	}
+	frameStepped = false;
 
 	updateHover(game, level, thisPtr);
 }
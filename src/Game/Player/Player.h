@@ -2,17 +2,19 @@
 
 #include "PlayerBase.h"
 
-class Player : public PlayerBase
+class Player final : public PlayerBase
 {
 private:
-	void updateAI(Level& level);
+	void updateAI(Game& game, Level& level);
 	void updateAnimation(const Game& game);
 	void updateWalk(Game& game, Level& level);
-	void updateAttack(Game& game, Level& level);
+	void updateAttack(Game& game, const std::shared_ptr<LevelObject>& thisPtr);
+	void updateHit(Game& game);
 	void updateDead(Game& game, Level& level);
 
 public:
 	using PlayerBase::PlayerBase;
 
+	void updateFrame(sf::Time elapsedTime, const LevelMap& map) override;
 	void update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr) override;
 };
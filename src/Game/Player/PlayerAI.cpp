@@ -0,0 +1,195 @@
+#include "PlayerAI.h"
+#include <algorithm>
+#include <cmath>
+#include "Game/Game.h"
+#include "Game/Level/Level.h"
+#include "Game/Player/Player.h"
+#include "PlayerCombat.h"
+#include "Utils/Random.h"
+
+bool PlayerAI::canSee(const PlayerBase& player, const LevelMap& map,
+	const PairFloat& targetPos, float distance, float radius) noexcept
+{
+	if (distance > radius)
+	{
+		return false;
+	}
+	return map.hasLineOfSight(
+		PairInt32((int32_t)player.mapPosition.x, (int32_t)player.mapPosition.y),
+		PairInt32((int32_t)targetPos.x, (int32_t)targetPos.y));
+}
+
+bool PlayerAI::walkTo(PlayerBase& player, Level& level, const PairFloat& pos)
+{
+	if (player.mapPosition == pos ||
+		level.useAIPathBudget() == false)
+	{
+		return false;
+	}
+	player.aiReplanTime = player.Class()->AIParams().replanTime;
+	player.setWalkPath(level.Map().getPath(player.mapPosition, pos), false);
+	return true;
+}
+
+void PlayerAI::update(PlayerBase& player, Game& game, Level& level)
+{
+	switch (player.playerStatus)
+	{
+	case PlayerStatus::Attack:
+	case PlayerStatus::Hit:
+	case PlayerStatus::Dead:
+		return;
+	default:
+		break;
+	}
+
+	const auto& params = player.Class()->AIParams();
+	auto elapsedTime = game.getElapsedTime();
+
+	if (player.aiStarted == false)
+	{
+		// spread the perception checks of the players over the think time.
+		player.aiStarted = true;
+		player.aiThinkTime = params.thinkTime * Random::getf<float>(RandomStream::AI);
+	}
+	player.aiReplanTime -= elapsedTime;
+	player.aiThinkTime -= elapsedTime;
+	if (player.aiThinkTime > sf::Time::Zero)
+	{
+		return;
+	}
+	player.aiThinkTime = params.thinkTime;
+	player.aiAlertTime -= params.thinkTime;
+
+	// perception
+	auto target = level.LevelObjects().CurrentPlayer();
+	if (target == nullptr ||
+		target.get() == &player ||
+		target->playerStatus == PlayerStatus::Dead)
+	{
+		player.aiState = PlayerAIState::Idle;
+		return;
+	}
+	const auto& targetPos = target->MapPosition();
+	auto dx = targetPos.x - player.mapPosition.x;
+	auto dy = targetPos.y - player.mapPosition.y;
+	auto distance = std::sqrt(dx * dx + dy * dy);
+	const auto& map = level.Map();
+
+	auto radius = (player.aiState == PlayerAIState::Idle ||
+		player.aiState == PlayerAIState::Alert) ? params.sightRadius : params.chaseRadius;
+	bool seen = canSee(player, map, targetPos, distance, radius);
+	if (seen == true)
+	{
+		player.aiTargetPosition = targetPos;
+	}
+
+	// transitions
+	const auto& props = player.properties;
+	auto maxLife = props.life + props.lifeItems;
+	bool flee = params.fleeLife > 0 &&
+		props.LifeNow() * 100 < maxLife * params.fleeLife;
+
+	switch (player.aiState)
+	{
+	case PlayerAIState::Idle:
+	case PlayerAIState::Alert:
+	case PlayerAIState::Chase:
+	case PlayerAIState::Attack:
+	{
+		if (seen == true)
+		{
+			if (flee == true)
+			{
+				player.aiState = PlayerAIState::Flee;
+			}
+			else
+			{
+				player.aiState = distance <= params.attackRange ?
+					PlayerAIState::Attack : PlayerAIState::Chase;
+			}
+		}
+		else if (player.aiState != PlayerAIState::Idle &&
+			player.aiState != PlayerAIState::Alert)
+		{
+			player.aiState = PlayerAIState::Alert;
+			player.aiAlertTime = params.alertTime;
+		}
+		else if (player.aiState == PlayerAIState::Alert &&
+			player.aiAlertTime <= sf::Time::Zero)
+		{
+			player.aiState = PlayerAIState::Idle;
+		}
+		break;
+	}
+	case PlayerAIState::Flee:
+	{
+		if (flee == false)
+		{
+			player.aiState = seen == true ? PlayerAIState::Chase : PlayerAIState::Alert;
+			player.aiAlertTime = params.alertTime;
+		}
+		else if (seen == false)
+		{
+			player.aiState = PlayerAIState::Idle;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+
+	// actions
+	bool canReplan = player.playerStatus == PlayerStatus::Stand ||
+		player.aiReplanTime <= sf::Time::Zero;
+
+	switch (player.aiState)
+	{
+	case PlayerAIState::Alert:
+	{
+		// search where the target was last seen.
+		if (player.playerStatus == PlayerStatus::Stand &&
+			player.aiReplanTime <= sf::Time::Zero)
+		{
+			walkTo(player, level, player.aiTargetPosition);
+		}
+		break;
+	}
+	case PlayerAIState::Chase:
+	{
+		if (canReplan == true)
+		{
+			walkTo(player, level, targetPos);
+		}
+		break;
+	}
+	case PlayerAIState::Attack:
+	{
+		if (player.playerStatus == PlayerStatus::Walk)
+		{
+			// stops at the end of the current step.
+			player.clearWalkPath();
+		}
+		else
+		{
+			player.Attack(target, PlayerAnimation::Attack1, DamageType::Physical,
+				params.attackRange > PlayerCombat::MeleeRange);
+		}
+		break;
+	}
+	case PlayerAIState::Flee:
+	{
+		if (canReplan == true && distance > 0.f)
+		{
+			auto fleeDistance = params.sightRadius / distance;
+			auto fleePos = PairFloat(
+				std::clamp(std::round(player.mapPosition.x - dx * fleeDistance), 0.f, map.MapSizef().x - 1.f),
+				std::clamp(std::round(player.mapPosition.y - dy * fleeDistance), 0.f, map.MapSizef().y - 1.f));
+			walkTo(player, level, fleePos);
+		}
+		break;
+	}
+	default:
+		break;
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Utils/PairXY.h"
+
+class Game;
+class Level;
+class LevelMap;
+class PlayerBase;
+
+// state machine of computer controlled players (aiType != 0).
+// perception runs every thinkTime (staggered between players) and path searches
+// share a per frame budget, so idle players far from the target cost almost nothing.
+class PlayerAI
+{
+private:
+	static bool canSee(const PlayerBase& player, const LevelMap& map,
+		const PairFloat& targetPos, float distance, float radius) noexcept;
+
+	static bool walkTo(PlayerBase& player, Level& level, const PairFloat& pos);
+
+public:
+	static void update(PlayerBase& player, Game& game, Level& level);
+};
@@ -2,12 +2,13 @@
 #include "Game/Game.h"
 #include "Game/Level/Level.h"
 #include "Game/Utils/GameUtils.h"
+#include "PlayerCombat.h"
 #include "PlayerLevelObject.h"
 #include "PlayerMove.h"
 #include "PlayerSave.h"
 #include "Utils/Utils.h"
 
-PlayerBase::PlayerBase(const PlayerClass* class__, const Level& level) : LevelObject(class__)
+PlayerBase::PlayerBase(const PlayerClass* class__, const Level& level) : LevelObject(class__, ObjectType)
 {
 	animation.animType = AnimationType::Looped;
 	lightSource = class__->getLightSource();
@@ -54,6 +55,12 @@ void PlayerBase::updateSpeed()
 	}
 }
 
+void PlayerBase::Attack(const std::shared_ptr<PlayerBase>& target, PlayerAnimation attackAnimation,
+	DamageType damageType, bool ranged)
+{
+	PlayerCombat::attack(*this, target, attackAnimation, damageType, ranged);
+}
+
 void PlayerBase::setWalkPath(const std::vector<PairFloat>& walkPath_, bool doAction)
 {
 	PlayerMove::setWalkPath(*this, walkPath_, doAction);
@@ -318,20 +325,23 @@ const SpellInstance* PlayerBase::getSpellInstance(const std::string_view key) co
 	return spells.getSpellInstance(key);
 }
 
-void PlayerBase::playSound(const std::string_view key, size_t soundNum)
+void PlayerBase::playSound(Game& game, const std::string_view key, size_t soundNum, int priority)
 {
 	auto sndBuffer = Class()->getSound(key, soundNum);
 	if (sndBuffer == nullptr)
 	{
 		return;
 	}
-	currentSound.setBuffer(*sndBuffer);
-	currentSound.play();
+	auto& sounds = game.Resources().Sounds();
+	sounds.stop(currentSound);
+	currentSound = sounds.play(*sndBuffer, 100.f,
+		{ mapPosition.x, mapPosition.y }, false, sf::Time::Zero, priority);
 }
 
 void PlayerBase::updateLevelFromExperience(const Level& level, bool updatePoints)
 {
 	auto oldLevel = properties.currentLevel;
+	properties.invalidate(PlayerInputs::Level | PlayerInputs::Damage);
 	properties.currentLevel = level.getLevelFromExperience(properties.experience);
 	properties.expNextLevel = level.getExperienceFromLevel(properties.currentLevel);
 	if (updatePoints == true &&
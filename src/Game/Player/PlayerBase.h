@@ -3,17 +3,19 @@
 #include "Game/GameHashes.h"
 #include "Game/LevelObject/LevelObject.h"
 #include "Game/Properties/AnimationSpeed.h"
+#include "Game/Properties/DamageType.h"
 #include "Game/VarOrQueryObject.h"
 #include "PlayerClass.h"
 #include "PlayerInventories.h"
 #include "PlayerProperties.h"
 #include "PlayerSpells.h"
-#include <SFML/Audio/Sound.hpp>
 #include "Utils/FixedMap.h"
 
 class PlayerBase : public LevelObject
 {
 protected:
+	friend class PlayerAI;
+	friend class PlayerCombat;
 	friend class PlayerLevelObject;
 	friend class PlayerMove;
 	friend class PlayerSave;
@@ -40,14 +42,34 @@ protected:
 	AnimationSpeed defaultSpeed{ sf::Time::Zero, sf::Time::Zero };
 
 	sf::Time currentWalkTime;
+	// time the next walk step has been blocked by another object.
+	sf::Time walkBlockedTime;
+	uint8_t walkRepaths{ 0 };
 
 	int aiType{ 0 };
+	PlayerAIState aiState{ PlayerAIState::Idle };
+	bool aiStarted{ false };
+	sf::Time aiThinkTime;
+	sf::Time aiReplanTime;
+	sf::Time aiAlertTime;
+	// last known position of the target.
+	PairFloat aiTargetPosition;
+
+	std::weak_ptr<PlayerBase> attackTarget;
+	DamageType attackDamageType{ DamageType::Physical };
+	bool attackRanged{ false };
+	bool attackResolved{ false };
+
+	// damage from attacks, applied on the next update.
+	LevelObjValue queuedDamage{ 0 };
+	std::weak_ptr<PlayerBase> lastAttacker;
 
 	PlayerInventories inventories;
 	PlayerSpells spells;
 	PlayerProperties properties;
 
-	sf::Sound currentSound;
+	// id of the last sound, replaced by the next one (a player makes one sound at a time).
+	uint64_t currentSound{ 0 };
 
 	void applyDefaults(const Level& level) noexcept;
 
@@ -55,7 +77,7 @@ protected:
 
 	void updateSpeed();
 
-	void playSound(const std::string_view key, size_t soundNum = 0);
+	void playSound(Game& game, const std::string_view key, size_t soundNum = 0, int priority = 0);
 
 public:
 	PlayerBase(const PlayerClass* class__, const Level& level);
@@ -64,6 +86,8 @@ public:
 
 	constexpr auto Class() const noexcept { return (const PlayerClass*)class_; }
 
+	static constexpr LevelObjectType ObjectType = LevelObjectType::Player;
+
 	bool Passable() const noexcept override { return false; }
 
 	const std::string_view getType() const override { return "player"; }
@@ -107,6 +131,9 @@ public:
 	void Walk(const LevelMap& map, const PairFloat& walkToMapPos, bool doAction);
 	void Walk(const LevelMap& map, const PlayerDirection direction, bool doAction);
 
+	void Attack(const std::shared_ptr<PlayerBase>& target, PlayerAnimation attackAnimation,
+		DamageType damageType, bool ranged);
+
 	void setDefaultSpeed(const AnimationSpeed& speed_);
 
 	auto getDirection() const noexcept { return playerDirection; }
@@ -190,7 +217,17 @@ public:
 	// next level and points added for having advanced n levels.
 	void updateLevelFromExperience(const Level& level, bool updatePoints);
 
+	// recomputes the derived properties (life, armor, ...) whose inputs changed.
 	void updateProperties() { properties.updateProperties(*this); }
+	void updateProperties(PlayerInputs changedInputs)
+	{
+		properties.invalidate(changedInputs);
+		properties.updateProperties(*this);
+	}
+
+	// property updates between begin and end are coalesced into one.
+	void beginUpdateProperties() noexcept { properties.beginUpdate(); }
+	void endUpdateProperties() { properties.endUpdate(*this); }
 
 	bool canUseObject(const LevelObjectQueryable& obj) const;
 
@@ -206,20 +243,20 @@ public:
 	void Id(const std::string_view id_) { id = id_; }
 	void Name(const std::string_view name_) { properties.name = name_; }
 
-	void CurrentLevel(uint32_t level_) noexcept { properties.currentLevel = level_; }
-	void Experience(uint32_t experience_) noexcept { properties.experience = experience_; }
-	void ExpNextLevel(uint32_t expNextLevel_) noexcept { properties.expNextLevel = expNextLevel_; }
-	void Points(uint32_t points_) noexcept { properties.points = points_; }
+	void CurrentLevel(uint32_t level_) noexcept { properties.currentLevel = level_; properties.invalidate(PlayerInputs::Level); }
+	void Experience(uint32_t experience_) noexcept { properties.experience = experience_; properties.invalidate(PlayerInputs::Level); }
+	void ExpNextLevel(uint32_t expNextLevel_) noexcept { properties.expNextLevel = expNextLevel_; properties.invalidate(PlayerInputs::Level); }
+	void Points(uint32_t points_) noexcept { properties.points = points_; properties.invalidate(PlayerInputs::Level); }
 
-	void Strength(LevelObjValue strength_) noexcept { properties.strength = strength_; }
-	void Magic(LevelObjValue magic_) noexcept { properties.magic = magic_; }
-	void Dexterity(LevelObjValue dexterity_) noexcept { properties.dexterity = dexterity_; }
-	void Vitality(LevelObjValue vitality_) noexcept { properties.vitality = vitality_; }
+	void Strength(LevelObjValue strength_) noexcept { properties.strength = strength_; properties.invalidate(PlayerInputs::BaseStats); }
+	void Magic(LevelObjValue magic_) noexcept { properties.magic = magic_; properties.invalidate(PlayerInputs::BaseStats); }
+	void Dexterity(LevelObjValue dexterity_) noexcept { properties.dexterity = dexterity_; properties.invalidate(PlayerInputs::BaseStats); }
+	void Vitality(LevelObjValue vitality_) noexcept { properties.vitality = vitality_; properties.invalidate(PlayerInputs::BaseStats); }
 
 	void Life(LevelObjValue life_) noexcept { properties.life = life_; }
-	void LifeDamage(LevelObjValue lifeDamage_) noexcept { properties.lifeDamage = lifeDamage_; }
+	void LifeDamage(LevelObjValue lifeDamage_) noexcept { properties.lifeDamage = lifeDamage_; properties.invalidate(PlayerInputs::Damage); }
 	void Mana(LevelObjValue manaBase_) noexcept { properties.mana = manaBase_; }
-	void ManaDamage(LevelObjValue manaDamage_) noexcept { properties.manaDamage = manaDamage_; }
+	void ManaDamage(LevelObjValue manaDamage_) noexcept { properties.manaDamage = manaDamage_; properties.invalidate(PlayerInputs::Damage); }
 
 	void Armor(LevelObjValue armor_) noexcept { properties.armor = armor_; }
 	void ToHit(LevelObjValue toHit_) noexcept { properties.toHit = toHit_; }
@@ -97,55 +97,38 @@ void PlayerClass::addSound(const std::string_view key, const sf::SoundBuffer& sn
 
 void PlayerClass::setFormula(uint16_t nameHash, const std::string_view formula)
 {
-	if (nameHash == str2int16(""))
-	{
-		return;
-	}
+	size_t idx = 0;
 	switch (nameHash)
 	{
 	case str2int16("life"):
-	{
-		formulas[0] = formula;
+		idx = LifeFormula;
 		break;
-	}
 	case str2int16("mana"):
-	{
-		formulas[1] = formula;
+		idx = ManaFormula;
 		break;
-	}
 	case str2int16("armor"):
-	{
-		formulas[2] = formula;
+		idx = ArmorFormula;
 		break;
-	}
 	case str2int16("toHit"):
-	{
-		formulas[3] = formula;
+		idx = ToHitFormula;
 		break;
-	}
 	case str2int16("damage"):
-	{
-		formulas[4] = formula;
+		idx = DamageFormula;
 		break;
-	}
 	case str2int16("resistMagic"):
-	{
-		formulas[5] = formula;
+		idx = ResistMagicFormula;
 		break;
-	}
 	case str2int16("resistFire"):
-	{
-		formulas[6] = formula;
+		idx = ResistFireFormula;
 		break;
-	}
 	case str2int16("resistLightning"):
-	{
-		formulas[7] = formula;
+		idx = ResistLightningFormula;
 		break;
-	}
 	default:
-		break;
+		return;
 	}
+	formulas[idx] = Formula(formula, RandomStream::Combat);
+	formulaInputs[idx] = PlayerProperties::getFormulaInputs(formulas[idx]);
 }
 
 void PlayerClass::deleteFormula(uint16_t nameHash)
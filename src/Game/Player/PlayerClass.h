@@ -7,7 +7,9 @@
 #include "Game/LevelObject/LevelObject.h"
 #include "Game/LevelObject/LevelObjectClassDefaults.h"
 #include "Game/Properties/AnimationSpeed.h"
+#include "Game/Properties/PlayerAIParams.h"
 #include "Game/Properties/PlayerAnimation.h"
+#include "Game/Properties/PlayerInputs.h"
 #include <SFML/Audio/SoundBuffer.hpp>
 #include <string>
 #include "Utils/UnorderedStringMap.h"
@@ -34,9 +36,19 @@ private:
 
 	uint32_t totalKills{ 0 };
 
+	// frame of the attack animation where the attack is resolved. -1 is the last frame.
+	int32_t attackFrame{ -1 };
+	// minimum damage that interrupts the player with the hit animation. 0 to disable.
+	LevelObjValue hitRecoveryDamage{ 1 };
+	bool dropItemsOnDeath{ false };
+
+	PlayerAIParams aiParams;
+
 	std::vector<std::pair<PlayerAnimation, AnimationSpeed>> animationSpeeds;
 
 	Formulas<std::array<Formula, 8>> formulas;
+	// inputs each formula depends on
+	std::array<PlayerInputs, 8> formulaInputs{};
 
 	UnorderedStringMultiMap<const sf::SoundBuffer*> sounds;
 
@@ -117,6 +129,12 @@ public:
 
 	auto TotalKills() const noexcept { return totalKills; }
 
+	auto AttackFrame() const noexcept { return attackFrame; }
+	auto HitRecoveryDamage() const noexcept { return hitRecoveryDamage; }
+	auto DropItemsOnDeath() const noexcept { return dropItemsOnDeath; }
+
+	auto& AIParams() const noexcept { return aiParams; }
+
 	auto& Outline() const noexcept { return outline; }
 	auto& OutlineIgnore() const noexcept { return outlineIgnore; }
 
@@ -132,43 +150,60 @@ public:
 	void TotalKills(LevelObjValue val) noexcept { totalKills = val; }
 	void addKill() noexcept { totalKills++; }
 
+	void AttackFrame(int32_t val) noexcept { attackFrame = val; }
+	void HitRecoveryDamage(LevelObjValue val) noexcept { hitRecoveryDamage = val; }
+	void DropItemsOnDeath(bool val) noexcept { dropItemsOnDeath = val; }
+
+	void AIParams(const PlayerAIParams& params) noexcept { aiParams = params; }
+
 	void Outline(const sf::Color& color) noexcept { outline = color; }
 	void OutlineIgnore(const sf::Color& color) noexcept { outlineIgnore = color; }
 
+	static constexpr size_t LifeFormula = 0;
+	static constexpr size_t ManaFormula = 1;
+	static constexpr size_t ArmorFormula = 2;
+	static constexpr size_t ToHitFormula = 3;
+	static constexpr size_t DamageFormula = 4;
+	static constexpr size_t ResistMagicFormula = 5;
+	static constexpr size_t ResistFireFormula = 6;
+	static constexpr size_t ResistLightningFormula = 7;
+
 	// if formula is empty, it clears the current formula.
 	void setFormula(uint16_t nameHash, const std::string_view formula);
 	void deleteFormula(uint16_t nameHash);
 
+	auto getFormulaInputs(size_t idx) const noexcept { return formulaInputs[idx]; }
+
 	auto getActualLife(const LevelObject& query, LevelObjValue default_) const
 	{
-		return formulas.eval(0, query, default_);
+		return formulas.eval(LifeFormula, query, default_);
 	}
 	auto getActualMana(const LevelObject& query, LevelObjValue default_) const
 	{
-		return formulas.eval(1, query, default_);
+		return formulas.eval(ManaFormula, query, default_);
 	}
 	auto getActualArmor(const LevelObject& query, LevelObjValue default_) const
 	{
-		return formulas.eval(2, query, default_);
+		return formulas.eval(ArmorFormula, query, default_);
 	}
 	auto getActualToHit(const LevelObject& query, LevelObjValue default_) const
 	{
-		return formulas.eval(3, query, default_);
+		return formulas.eval(ToHitFormula, query, default_);
 	}
 	auto getActualDamage(const LevelObject& query, LevelObjValue default_) const
 	{
-		return formulas.eval(4, query, default_);
+		return formulas.eval(DamageFormula, query, default_);
 	}
 	auto getActualResistMagic(const LevelObject& query, LevelObjValue default_) const
 	{
-		return formulas.eval(5, query, default_);
+		return formulas.eval(ResistMagicFormula, query, default_);
 	}
 	auto getActualResistFire(const LevelObject& query, LevelObjValue default_) const
 	{
-		return formulas.eval(6, query, default_);
+		return formulas.eval(ResistFireFormula, query, default_);
 	}
 	auto getActualResistLightning(const LevelObject& query, LevelObjValue default_) const
 	{
-		return formulas.eval(7, query, default_);
+		return formulas.eval(ResistLightningFormula, query, default_);
 	}
 };
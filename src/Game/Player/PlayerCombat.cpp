@@ -0,0 +1,296 @@
+#include "PlayerCombat.h"
+#include <algorithm>
+#include <cmath>
+#include "Game/Game.h"
+#include "Game/Level/Level.h"
+#include "Game/Player/PlayerBase.h"
+#include "Utils/StringHash.h"
+
+PlayerCombat::Stats PlayerCombat::getStats(const PlayerBase& player) noexcept
+{
+	const auto& props = player.properties;
+	Stats stats;
+	stats.toHit = props.toHit;
+	stats.armor = props.armor;
+	stats.damageMin = props.damageMin;
+	stats.damageMax = props.damageMax;
+	stats.resistMagic = props.resistMagic;
+	stats.resistFire = props.resistFire;
+	stats.resistLightning = props.resistLightning;
+	return stats;
+}
+
+LevelObjValue PlayerCombat::getHitChance(const Stats& attacker, const Stats& defender, float distance) noexcept
+{
+	auto chance = attacker.toHit - defender.armor - (LevelObjValue)distance;
+	return std::clamp(chance, 5, 95);
+}
+
+LevelObjValue PlayerCombat::getDamage(const Stats& defender, LevelObjValue damage, DamageType damageType) noexcept
+{
+	LevelObjValue resist = 0;
+	switch (damageType)
+	{
+	case DamageType::Magic:
+		resist = defender.resistMagic;
+		break;
+	case DamageType::Fire:
+		resist = defender.resistFire;
+		break;
+	case DamageType::Lightning:
+		resist = defender.resistLightning;
+		break;
+	default:
+		break;
+	}
+	resist = std::clamp(resist, 0, 100);
+	return std::max(damage - (damage * resist) / 100, 0);
+}
+
+PlayerCombat::Result PlayerCombat::resolveAttack(const Stats& attacker, const Stats& defender,
+	DamageType damageType, float distance, PCG32& rng)
+{
+	Result result;
+	auto chance = getHitChance(attacker, defender, distance);
+	if (Random::get(rng, 0, 99) >= chance)
+	{
+		return result;
+	}
+	result.hit = true;
+	auto damageMin = std::max(attacker.damageMin, 0);
+	auto damageMax = std::max(attacker.damageMax, damageMin);
+	auto damage = Random::get(rng, damageMin, damageMax);
+	result.damage = getDamage(defender, damage, damageType);
+	return result;
+}
+
+bool PlayerCombat::addDamage(PlayerBase& player, const std::weak_ptr<PlayerBase>& attacker,
+	LevelObjValue damage, DamageType damageType)
+{
+	if (player.playerStatus == PlayerStatus::Dead)
+	{
+		return false;
+	}
+	player.queuedDamage += getDamage(getStats(player), damage, damageType);
+	player.lastAttacker = attacker;
+	return true;
+}
+
+void PlayerCombat::attack(PlayerBase& player, const std::shared_ptr<PlayerBase>& target,
+	PlayerAnimation attackAnimation, DamageType damageType, bool ranged)
+{
+	if (target == nullptr ||
+		target.get() == &player ||
+		player.playerStatus == PlayerStatus::Attack ||
+		player.playerStatus == PlayerStatus::Hit ||
+		player.playerStatus == PlayerStatus::Dead)
+	{
+		return;
+	}
+	player.clearWalkPath();
+	player.attackTarget = target;
+	player.attackDamageType = damageType;
+	player.attackRanged = ranged;
+	player.attackResolved = false;
+	player.playerStatus = PlayerStatus::Attack;
+	player.setDirection(getPlayerDirection(player.mapPosition, target->MapPosition()));
+	player.playerAnimation = PlayerAnimation::Size;
+	player.setAnimation(attackAnimation);
+	player.animation.reset();
+	player.animation.animType = AnimationType::PlayOnce;
+	player.resetAnimationTime();
+}
+
+void PlayerCombat::updateAttack(PlayerBase& player, const std::shared_ptr<LevelObject>& thisPtr)
+{
+	const auto& anim = player.animation;
+	if (player.attackResolved == false)
+	{
+		auto attackFrame = player.Class()->AttackFrame();
+		auto frame = anim.currentTextureIdx - anim.textureIndexRange.first;
+		if ((attackFrame >= 0 && frame >= (uint32_t)attackFrame) ||
+			anim.isAnimationAtEnd() == true)
+		{
+			player.attackResolved = true;
+			auto target = player.attackTarget.lock();
+			player.attackTarget.reset();
+			if (target != nullptr &&
+				target->playerStatus != PlayerStatus::Dead)
+			{
+				auto dx = target->MapPosition().x - player.mapPosition.x;
+				auto dy = target->MapPosition().y - player.mapPosition.y;
+				auto distance = std::sqrt(dx * dx + dy * dy);
+				Result result;
+				if (player.attackRanged == true || distance <= MeleeRange)
+				{
+					result = resolveAttack(getStats(player), getStats(*target),
+						player.attackDamageType, player.attackRanged == true ? distance : 0.f,
+						Random::Generator(RandomStream::Combat));
+				}
+				if (result.hit == true)
+				{
+					target->queuedDamage += result.damage;
+					target->lastAttacker = std::static_pointer_cast<PlayerBase>(thisPtr);
+					player.queueAction(*player.class_, str2int16("attackHit"));
+				}
+				else
+				{
+					player.queueAction(*player.class_, str2int16("attackMiss"));
+				}
+			}
+		}
+	}
+	if (anim.isAnimationAtEnd() == true)
+	{
+		player.playerStatus = PlayerStatus::Stand;
+		player.setStandAnimation();
+		player.resetAnimationTime();
+	}
+}
+
+void PlayerCombat::applyQueuedDamage(PlayerBase& player)
+{
+	if (player.queuedDamage <= 0)
+	{
+		player.queuedDamage = 0;
+		return;
+	}
+	auto damage = player.queuedDamage;
+	player.queuedDamage = 0;
+	if (player.playerStatus == PlayerStatus::Dead)
+	{
+		return;
+	}
+	player.LifeDamage(player.properties.lifeDamage + damage);
+	player.updateProperties();
+	player.queueAction(*player.class_, str2int16("hit"));
+
+	auto hitRecoveryDamage = player.Class()->HitRecoveryDamage();
+	if (hitRecoveryDamage > 0 &&
+		damage >= hitRecoveryDamage &&
+		player.properties.LifeNow() > 0)
+	{
+		player.clearWalkPath();
+		player.attackTarget.reset();
+		player.playerStatus = PlayerStatus::Hit;
+		player.playerAnimation = PlayerAnimation::Size;
+		player.setAnimation((PlayerAnimation)((size_t)PlayerAnimation::Hit1 + player.restStatus));
+		player.animation.reset();
+		player.animation.animType = AnimationType::PlayOnce;
+		player.resetAnimationTime();
+	}
+}
+
+void PlayerCombat::updateHit(PlayerBase& player)
+{
+	if (player.animation.isAnimationAtEnd() == true)
+	{
+		player.playerStatus = PlayerStatus::Stand;
+		player.setStandAnimation();
+		player.resetAnimationTime();
+	}
+}
+
+void PlayerCombat::onDeath(PlayerBase& player, Game& game, Level& level)
+{
+	player.clearWalkPath();
+	player.attackTarget.reset();
+	player.queueAction(*player.class_, str2int16("die"));
+
+	if (auto attacker = player.lastAttacker.lock())
+	{
+		attacker->queueAction(*attacker->class_, str2int16("kill"));
+	}
+	player.lastAttacker.reset();
+
+	if (player.Class()->DropItemsOnDeath() == false)
+	{
+		return;
+	}
+
+	// drops the items on the free cells closest to the player.
+	auto center = PairInt32((int32_t)player.mapPosition.x, (int32_t)player.mapPosition.y);
+	int32_t radius = 0;
+	int32_t offsetIdx = 0;
+	auto nextCoord = [&](PairFloat& mapCoord) -> bool
+	{
+		while (radius <= 2)
+		{
+			auto size = radius * 2 + 1;
+			auto numCells = radius == 0 ? 1 : size * size - (size - 2) * (size - 2);
+			while (offsetIdx < numCells)
+			{
+				auto idx = offsetIdx++;
+				int32_t x, y;
+				if (radius == 0)
+				{
+					x = y = 0;
+				}
+				else if (idx < size)
+				{
+					x = idx - radius;
+					y = -radius;
+				}
+				else if (idx < size * 2)
+				{
+					x = idx - size - radius;
+					y = radius;
+				}
+				else
+				{
+					idx -= size * 2;
+					x = (idx % 2 == 0 ? -radius : radius);
+					y = idx / 2 - radius + 1;
+				}
+				mapCoord = PairFloat((float)(center.x + x), (float)(center.y + y));
+				if (level.Map().isMapCoordValid(mapCoord) == true)
+				{
+					return true;
+				}
+			}
+			radius++;
+			offsetIdx = 0;
+		}
+		return false;
+	};
+
+	player.beginUpdateProperties();
+	for (size_t invIdx = 0; invIdx < player.getInventorySize(); invIdx++)
+	{
+		auto& inventory = player.getInventory(invIdx);
+		for (size_t itemIdx = 0; itemIdx < inventory.Size(); itemIdx++)
+		{
+			if (inventory.get(itemIdx) == nullptr)
+			{
+				continue;
+			}
+			std::shared_ptr<Item> nullItem;
+			std::shared_ptr<Item> item2;
+			if (player.setItem(invIdx, itemIdx, nullItem, item2) == false ||
+				item2 == nullptr)
+			{
+				continue;
+			}
+			auto item = item2.get();
+			bool dropped = false;
+			PairFloat mapCoord;
+			while (nextCoord(mapCoord) == true)
+			{
+				if (level.setItem(mapCoord, item2) == true)
+				{
+					item->resetDropAnimation(level);
+					item->Class()->executeAction(game, str2int16("levelDrop"));
+					dropped = true;
+					break;
+				}
+			}
+			if (dropped == false)
+			{
+				player.setItem(invIdx, itemIdx, item2);
+				player.endUpdateProperties();
+				return;
+			}
+		}
+	}
+	player.endUpdateProperties();
+}
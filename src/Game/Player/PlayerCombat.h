@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Game/Properties/DamageType.h"
+#include "Game/Properties/LevelObjValue.h"
+#include "Game/Properties/PlayerAnimation.h"
+#include <memory>
+#include "Utils/Random.h"
+
+class Game;
+class Level;
+class LevelObject;
+class PlayerBase;
+
+// resolves melee and ranged attacks between players.
+// the game rolls with the combat random stream, so a seeded game always has the same outcome.
+class PlayerCombat
+{
+public:
+	// values of the attacker and defender used to resolve an attack.
+	struct Stats
+	{
+		LevelObjValue toHit{ 0 };
+		LevelObjValue armor{ 0 };
+		LevelObjValue damageMin{ 0 };
+		LevelObjValue damageMax{ 0 };
+		LevelObjValue resistMagic{ 0 };
+		LevelObjValue resistFire{ 0 };
+		LevelObjValue resistLightning{ 0 };
+	};
+
+	struct Result
+	{
+		bool hit{ false };
+		LevelObjValue damage{ 0 };
+	};
+
+	// max distance (in map cells) of a melee attack.
+	static constexpr float MeleeRange = 1.5f;
+
+	static Stats getStats(const PlayerBase& player) noexcept;
+
+	// chance to hit in % (5-95). ranged attacks lose 1% per cell of distance.
+	static LevelObjValue getHitChance(const Stats& attacker, const Stats& defender, float distance) noexcept;
+
+	static LevelObjValue getDamage(const Stats& defender, LevelObjValue damage, DamageType damageType) noexcept;
+
+	// rolls the hit and the damage with rng. only changes rng.
+	static Result resolveAttack(const Stats& attacker, const Stats& defender,
+		DamageType damageType, float distance, PCG32& rng);
+
+	// queues damage (after resistances) from an attacker that isn't a melee/ranged attack.
+	// returns false if the player can't be damaged.
+	static bool addDamage(PlayerBase& player, const std::weak_ptr<PlayerBase>& attacker,
+		LevelObjValue damage, DamageType damageType);
+
+	static void attack(PlayerBase& player, const std::shared_ptr<PlayerBase>& target,
+		PlayerAnimation attackAnimation, DamageType damageType, bool ranged);
+
+	// resolves the attack once the attack frame is reached and
+	// returns to standing when the attack animation ends.
+	static void updateAttack(PlayerBase& player, const std::shared_ptr<LevelObject>& thisPtr);
+
+	// applies the damage queued by the attackers since the last update.
+	static void applyQueuedDamage(PlayerBase& player);
+
+	static void updateHit(PlayerBase& player);
+
+	static void onDeath(PlayerBase& player, Game& game, Level& level);
+};
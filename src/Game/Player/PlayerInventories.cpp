@@ -87,7 +87,7 @@ bool PlayerInventories::setItem(PlayerBase& player, size_t invIdx,
 		}
 		if (bodyInventoryIdx == invIdx)
 		{
-			player.updateProperties();
+			player.updateProperties(PlayerInputs::Items);
 		}
 	}
 	return ret;
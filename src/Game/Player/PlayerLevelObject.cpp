@@ -220,6 +220,9 @@ bool PlayerLevelObject::getProperty(const PlayerBase& player, const std::string_
 	case str2int16("isAttacking"):
 		var = Variable(player.playerStatus == PlayerStatus::Attack);
 		break;
+	case str2int16("isHit"):
+		var = Variable(player.playerStatus == PlayerStatus::Hit);
+		break;
 	case str2int16("isDead"):
 		var = Variable(player.playerStatus == PlayerStatus::Dead);
 		break;
@@ -1,6 +1,6 @@
 #include "PlayerMove.h"
 #include "Game/Game.h"
-#include "Game/Level/LevelMap.h"
+#include "Game/Level/Level.h"
 #include "Game/Player/PlayerBase.h"
 
 bool PlayerMove::MapPosition(PlayerBase& player, LevelMap& map, const PairFloat& pos)
@@ -48,6 +48,8 @@ void PlayerMove::setWalkPath(PlayerBase& player, const std::vector<PairFloat>& w
 		return;
 	}
 	player.walkPath = walkPath_;
+	player.walkBlockedTime = sf::Time::Zero;
+	player.walkRepaths = 0;
 	player.executeActionOnDestination = doAction;
 	player.playerStatus = PlayerStatus::Walk;
 	if (player.walkPath.empty() == false)
@@ -104,6 +106,61 @@ void PlayerMove::Walk(PlayerBase& player, const LevelMap& map, const PlayerDirec
 	}
 }
 
+PlayerMove::BlockedStep PlayerMove::onBlockedStep(sf::Time& blockedTime,
+	uint8_t repaths, sf::Time stepTime) noexcept
+{
+	blockedTime += stepTime;
+	if (blockedTime.asMilliseconds() < MaxBlockedTime)
+	{
+		return BlockedStep::Wait;
+	}
+	if (repaths < MaxBlockedRepaths)
+	{
+		return BlockedStep::Repath;
+	}
+	return BlockedStep::GiveUp;
+}
+
+void PlayerMove::waitOnBlockedStep(PlayerBase& player, Level& level)
+{
+	if (player.hasWalkingAnimation() == true)
+	{
+		player.setStandAnimation();
+		player.resetAnimationTime();
+	}
+	switch (onBlockedStep(player.walkBlockedTime, player.walkRepaths, player.speed.walk))
+	{
+	case BlockedStep::Wait:
+		return;
+	case BlockedStep::Repath:
+	{
+		// other players share the AI path budget. if it's used up,
+		// they keep waiting and search again on their next step.
+		if ((const PlayerBase*)level.LevelObjects().CurrentPlayer().get() != &player &&
+			level.useAIPathBudget() == false)
+		{
+			return;
+		}
+		player.walkBlockedTime = sf::Time::Zero;
+		auto path = level.Map().getPath(player.mapPosition, player.walkPath.front());
+		if (path.empty() == false)
+		{
+			player.walkRepaths++;
+			player.walkPath = std::move(path);
+			return;
+		}
+		break;
+	}
+	default:
+		player.walkBlockedTime = sf::Time::Zero;
+		break;
+	}
+	player.clearWalkPath();
+	player.setStandAnimation();
+	player.resetAnimationTime();
+	player.playerStatus = PlayerStatus::Stand;
+}
+
 void PlayerMove::updateWalkPathStep(PlayerBase& player, PairFloat& newMapPos)
 {
 	newMapPos.x -= (player.mapPosA.x - player.mapPosB.x) * player.currPositionStep;
@@ -124,8 +181,9 @@ void PlayerMove::updateWalkPathStep(PlayerBase& player, PairFloat& newMapPos)
 	}
 }
 
-void PlayerMove::updateWalkPath(PlayerBase& player, Game& game, LevelMap& map)
+void PlayerMove::updateWalkPath(PlayerBase& player, Game& game, Level& level)
 {
+	auto& map = level.Map();
 	player.currentWalkTime += game.getElapsedTime();
 
 	while (player.currentWalkTime >= player.speed.walk)
@@ -171,10 +229,18 @@ void PlayerMove::updateWalkPath(PlayerBase& player, Game& game, LevelMap& map)
 					player.walkPath.pop_back();
 					continue;
 				}
-				player.playSound("walk");
+				// the cell is taken when the step starts, so other walkers wait or go around.
+				if (map.avoidBlockedStep(player, player.walkPath) == false)
+				{
+					waitOnBlockedStep(player, level);
+					break;
+				}
+				player.walkBlockedTime = sf::Time::Zero;
+				const auto stepMapPos = player.walkPath.back();
+				player.playSound(game, "walk", 0, -1);
 				player.setWalkAnimation();
-				player.setDirection(getPlayerDirection(player.mapPosition, nextMapPos));
-				MapPosition(player, map, nextMapPos);
+				player.setDirection(getPlayerDirection(player.mapPosition, stepMapPos));
+				MapPosition(player, map, stepMapPos);
 				player.positionStep = 1.6f / map.DefaultTileWidth();
 				player.currPositionStep = player.positionStep;
 				updateWalkPathStep(player, newMapPos);
@@ -1,16 +1,38 @@
 #pragma once
 
 #include "Game/Properties/PlayerDirection.h"
+#include <cstdint>
+#include <SFML/System/Time.hpp>
 #include "Utils/PairXY.h"
 #include <vector>
 
 class Game;
+class Level;
 class LevelMap;
 class PlayerBase;
 
 class PlayerMove
 {
+private:
+	static void waitOnBlockedStep(PlayerBase& player, Level& level);
+
 public:
+	enum class BlockedStep
+	{
+		Wait,
+		Repath,
+		GiveUp
+	};
+
+	// time (ms) to wait for a blocked walk step before searching a new path.
+	static constexpr int32_t MaxBlockedTime = 400;
+	// new path searches when blocked before giving up and standing.
+	static constexpr uint8_t MaxBlockedRepaths = 2;
+
+	// adds the step time to the time blocked and returns what a walker blocked
+	// on its next step does. also used by the crowd benchmark.
+	static BlockedStep onBlockedStep(sf::Time& blockedTime, uint8_t repaths, sf::Time stepTime) noexcept;
+
 	static bool MapPosition(PlayerBase& player, LevelMap& map, const PairFloat& pos);
 
 	static bool move(PlayerBase& player, LevelMap& map, const PairFloat& pos);
@@ -21,5 +43,5 @@ public:
 
 	static void updateWalkPathStep(PlayerBase& player, PairFloat& newMapPos);
 
-	static void updateWalkPath(PlayerBase& player, Game& game, LevelMap& map);
+	static void updateWalkPath(PlayerBase& player, Game& game, Level& level);
 };
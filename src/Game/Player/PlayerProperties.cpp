@@ -1,5 +1,6 @@
 #include "PlayerProperties.h"
 #include <algorithm>
+#include "Game/Formula.h"
 #include "Game/GameHashes.h"
 #include "PlayerBase.h"
 
@@ -170,21 +171,27 @@ bool PlayerProperties::setIntByHash(const PlayerClass& class_, uint16_t propHash
 	{
 	case str2int16("strength"):
 		strength = std::clamp(value, 0, class_.MaxStrength());
+		invalidate(PlayerInputs::BaseStats);
 		break;
 	case str2int16("magic"):
 		magic = std::clamp(value, 0, class_.MaxMagic());
+		invalidate(PlayerInputs::BaseStats);
 		break;
 	case str2int16("dexterity"):
 		dexterity = std::clamp(value, 0, class_.MaxDexterity());
+		invalidate(PlayerInputs::BaseStats);
 		break;
 	case str2int16("vitality"):
 		vitality = std::clamp(value, 0, class_.MaxVitality());
+		invalidate(PlayerInputs::BaseStats);
 		break;
 	case str2int16("lifeDamage"):
 		lifeDamage = std::max(value, 0);
+		invalidate(PlayerInputs::Damage);
 		break;
 	case str2int16("manaDamage"):
 		manaDamage = std::max(value, 0);
+		invalidate(PlayerInputs::Damage);
 		break;
 	default:
 		return false;
@@ -212,6 +219,7 @@ bool PlayerProperties::setUIntByHash(PlayerBase& player, uint16_t propHash, uint
 	default:
 		return false;
 	}
+	invalidate(PlayerInputs::Level);
 	updateNameAndDescr = true;
 	return true;
 }
@@ -270,6 +278,7 @@ bool PlayerProperties::setNumberByHash(PlayerBase& player, uint16_t propHash, co
 	default:
 	{
 		updateNameAndDescr = true;
+		invalidate(PlayerInputs::Custom);
 		return custom.setValue(propHash, value);
 	}
 	}
@@ -280,6 +289,7 @@ void PlayerProperties::updateNameAndDescriptions(const PlayerBase& player) const
 	if (updateNameAndDescr == true)
 	{
 		updateNameAndDescr = false;
+		Formula::CosmeticScope cosmeticScope;
 		if (player.Class()->getFullName(player, name) == false &&
 			name.empty() == true)
 		{
@@ -430,25 +440,148 @@ void PlayerProperties::updateBodyItemValues(PlayerBase& player)
 	}
 }
 
+PlayerInputs PlayerProperties::getInputs(const std::string_view prop) noexcept
+{
+	switch (str2int16(prop))
+	{
+	case str2int16("strength"):
+	case str2int16("magic"):
+	case str2int16("dexterity"):
+	case str2int16("vitality"):
+		return PlayerInputs::BaseStats;
+	case str2int16("strengthItems"):
+	case str2int16("magicItems"):
+	case str2int16("dexterityItems"):
+	case str2int16("vitalityItems"):
+	case str2int16("lifeItems"):
+	case str2int16("manaItems"):
+	case str2int16("armorItems"):
+	case str2int16("toHitItems"):
+	case str2int16("damageMinItems"):
+	case str2int16("damageMaxItems"):
+	case str2int16("resistMagicItems"):
+	case str2int16("resistFireItems"):
+	case str2int16("resistLightningItems"):
+		return PlayerInputs::ItemValues;
+	case str2int16("strengthNow"):
+	case str2int16("magicNow"):
+	case str2int16("dexterityNow"):
+	case str2int16("vitalityNow"):
+		return PlayerInputs::BaseStats | PlayerInputs::ItemValues;
+	case str2int16("lifeDamage"):
+	case str2int16("manaDamage"):
+		return PlayerInputs::Damage;
+	case str2int16("level"):
+	case str2int16("experience"):
+	case str2int16("expNextLevel"):
+	case str2int16("points"):
+		return PlayerInputs::Level;
+	case str2int16("maxStrength"):
+	case str2int16("maxMagic"):
+	case str2int16("maxDexterity"):
+	case str2int16("maxVitality"):
+	case str2int16("maxResistMagic"):
+	case str2int16("maxResistFire"):
+	case str2int16("maxResistLightning"):
+		return PlayerInputs::None;
+	default:
+		// derived values (life, armor, ...), custom and other properties
+		return PlayerInputs::All;
+	}
+}
+
+PlayerInputs PlayerProperties::getFormulaInputs(const Formula& formula)
+{
+	if (formula.hasRandom() == true)
+	{
+		return PlayerInputs::All;
+	}
+	auto inputs = PlayerInputs::None;
+	formula.forEachVariable([&inputs](const std::string_view prop)
+	{
+		inputs |= getInputs(prop);
+	});
+	return inputs;
+}
+
 void PlayerProperties::updateProperties(PlayerBase& player)
 {
-	updateBodyItemValues(player);
+	if (batchDepth > 0 ||
+		dirtyInputs == PlayerInputs::None)
+	{
+		return;
+	}
+	auto dirty = dirtyInputs;
+	dirtyInputs = PlayerInputs::None;
 
-	auto class_ = player.Class();
+	// item requirements depend on the base stats and level (canUseObject)
+	if ((dirty & (PlayerInputs::Items | PlayerInputs::BaseStats |
+		PlayerInputs::Level | PlayerInputs::Custom)) != PlayerInputs::None)
+	{
+		updateBodyItemValues(player);
+		armorFromItems = armor;
+		damageMinFromItems = damageMin;
+		damageMaxFromItems = damageMax;
+		dirty |= PlayerInputs::ItemValues;
+	}
 
-	life = class_->getActualLife(player, life);
-	mana = class_->getActualMana(player, mana);
-	armor += class_->getActualArmor(player, 0);
-	toHit = class_->getActualToHit(player, toHit);
+	// formulas see armor and damage without the class values, as they were before
+	armor = armorFromItems;
+	damageMin = damageMinFromItems;
+	damageMax = damageMaxFromItems;
 
-	resistMagic = class_->getActualResistMagic(player, resistMagicItems);
-	resistMagic = std::clamp(resistMagic, 0, class_->MaxResistMagic());
-	resistFire = class_->getActualResistFire(player, resistFireItems);
-	resistFire = std::clamp(resistFire, 0, class_->MaxResistFire());
-	resistLightning = class_->getActualResistLightning(player, resistLightningItems);
-	resistLightning = std::clamp(resistLightning, 0, class_->MaxResistLightning());
+	auto class_ = player.Class();
+	auto isDirty = [class_, dirty](size_t formulaIdx)
+	{
+		return (class_->getFormulaInputs(formulaIdx) & dirty) != PlayerInputs::None;
+	};
+	bool itemValuesDirty = (dirty & PlayerInputs::ItemValues) != PlayerInputs::None;
 
-	auto damage = class_->getActualDamage(player, 0);
-	damageMin += damage;
-	damageMax += damage;
+	if (isDirty(PlayerClass::LifeFormula) == true)
+	{
+		life = class_->getActualLife(player, life);
+	}
+	if (isDirty(PlayerClass::ManaFormula) == true)
+	{
+		mana = class_->getActualMana(player, mana);
+	}
+	if (isDirty(PlayerClass::ArmorFormula) == true)
+	{
+		armorFromClass = class_->getActualArmor(player, 0);
+	}
+	armor += armorFromClass;
+	if (isDirty(PlayerClass::ToHitFormula) == true)
+	{
+		toHit = class_->getActualToHit(player, toHit);
+	}
+	if (isDirty(PlayerClass::ResistMagicFormula) == true || itemValuesDirty == true)
+	{
+		resistMagic = class_->getActualResistMagic(player, resistMagicItems);
+		resistMagic = std::clamp(resistMagic, 0, class_->MaxResistMagic());
+	}
+	if (isDirty(PlayerClass::ResistFireFormula) == true || itemValuesDirty == true)
+	{
+		resistFire = class_->getActualResistFire(player, resistFireItems);
+		resistFire = std::clamp(resistFire, 0, class_->MaxResistFire());
+	}
+	if (isDirty(PlayerClass::ResistLightningFormula) == true || itemValuesDirty == true)
+	{
+		resistLightning = class_->getActualResistLightning(player, resistLightningItems);
+		resistLightning = std::clamp(resistLightning, 0, class_->MaxResistLightning());
+	}
+	if (isDirty(PlayerClass::DamageFormula) == true)
+	{
+		damageFromClass = class_->getActualDamage(player, 0);
+	}
+	damageMin += damageFromClass;
+	damageMax += damageFromClass;
+}
+
+void PlayerProperties::endUpdate(PlayerBase& player)
+{
+	if (batchDepth > 0)
+	{
+		batchDepth--;
+	}
+	updateProperties(player);
 }
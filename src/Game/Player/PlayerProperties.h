@@ -1,10 +1,12 @@
 #pragma once
 
 #include "Game/Properties/LevelObjValue.h"
+#include "Game/Properties/PlayerInputs.h"
 #include "Game/Spell/SpellInstance.h"
 #include "Utils/FixedMap.h"
 #include "Utils/Number.h"
 
+class Formula;
 class Level;
 class PlayerBase;
 class PlayerClass;
@@ -57,6 +59,23 @@ struct PlayerProperties
 
 	FixedMap<uint16_t, Number32, 8> custom;
 
+	// inputs changed since the last update. derived values are only
+	// recomputed if one of their inputs changed.
+	PlayerInputs dirtyInputs{ PlayerInputs::All };
+	// updates are deferred while > 0
+	uint32_t batchDepth{ 0 };
+
+	// armor and damage from the body items and from the class formulas
+	LevelObjValue armorFromItems{ 0 };
+	LevelObjValue armorFromClass{ 0 };
+	LevelObjValue damageMinFromItems{ 0 };
+	LevelObjValue damageMaxFromItems{ 0 };
+	LevelObjValue damageFromClass{ 0 };
+
+	// inputs a property used in a formula depends on.
+	static PlayerInputs getInputs(const std::string_view prop) noexcept;
+	static PlayerInputs getFormulaInputs(const Formula& formula);
+
 	bool getIntByHash(const PlayerClass& class_, uint16_t propHash, LevelObjValue& value) const noexcept;
 
 	bool getUIntByHash(uint16_t propHash, uint32_t& value) const noexcept;
@@ -83,5 +102,11 @@ struct PlayerProperties
 
 	void updateBodyItemValues(PlayerBase& player);
 
+	void invalidate(PlayerInputs inputs) noexcept { dirtyInputs |= inputs; }
+
+	// recomputes the derived values whose inputs changed.
 	void updateProperties(PlayerBase& player);
+
+	void beginUpdate() noexcept { batchDepth++; }
+	void endUpdate(PlayerBase& player);
 };
@@ -50,6 +50,9 @@ void PlayerSave::serialize(const PlayerBase& player, const Level& level, void* s
 	case PlayerStatus::Attack:
 		writeStringView(writer, "Attack");
 		break;
+	case PlayerStatus::Hit:
+		writeStringView(writer, "Hit");
+		break;
 	case PlayerStatus::Dead:
 		writeStringView(writer, "Dead");
 		break;
@@ -0,0 +1,290 @@
+#include "Projectile.h"
+#include <cmath>
+#include <limits>
+#include "Game/Game.h"
+#include "Game/Level/Level.h"
+#include "Game/Player/PlayerBase.h"
+#include "Game/Player/PlayerCombat.h"
+#include "Game/Properties/PlayerDirection.h"
+#include "Game/Spell/Spell.h"
+#include "Game/Utils/GameUtils2.h"
+#include "Utils/StringHash.h"
+#include "Utils/Utils.h"
+
+namespace
+{
+	// calls fn(cell) for the cells crossed by the segment from a to b, in order,
+	// until fn returns false. returns false if it stopped early.
+	template <class Fn>
+	bool forEachCellOnSegment(const PairFloat& a, const PairFloat& b, Fn fn)
+	{
+		auto x = (int32_t)std::floor(a.x);
+		auto y = (int32_t)std::floor(a.y);
+		auto endX = (int32_t)std::floor(b.x);
+		auto endY = (int32_t)std::floor(b.y);
+		auto dx = b.x - a.x;
+		auto dy = b.y - a.y;
+		int32_t stepX = (dx > 0.f) - (dx < 0.f);
+		int32_t stepY = (dy > 0.f) - (dy < 0.f);
+		auto tDeltaX = stepX != 0 ? std::abs(1.f / dx) : INFINITY;
+		auto tDeltaY = stepY != 0 ? std::abs(1.f / dy) : INFINITY;
+		auto tMaxX = stepX > 0 ? ((float)x + 1.f - a.x) * tDeltaX :
+			(stepX < 0 ? (a.x - (float)x) * tDeltaX : INFINITY);
+		auto tMaxY = stepY > 0 ? ((float)y + 1.f - a.y) * tDeltaY :
+			(stepY < 0 ? (a.y - (float)y) * tDeltaY : INFINITY);
+
+		if (fn(PairInt32(x, y)) == false)
+		{
+			return false;
+		}
+		auto numCells = std::abs(endX - x) + std::abs(endY - y);
+		for (int32_t i = 0; i < numCells; i++)
+		{
+			if (tMaxX < tMaxY)
+			{
+				x += stepX;
+				tMaxX += tDeltaX;
+			}
+			else
+			{
+				y += stepY;
+				tMaxY += tDeltaY;
+			}
+			if (fn(PairInt32(x, y)) == false)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+Projectile::Projectile(const Spell* spell) : LevelObject(spell, ObjectType)
+{
+	enableHover = false;
+}
+
+void Projectile::init(const Spell* spell, const std::shared_ptr<PlayerBase>& owner_,
+	const PairFloat& origin, const PairFloat& target, LevelObjValue damage_,
+	LevelObjValue speed, LevelObjValue duration, LevelObjValue hitInterval_)
+{
+	class_ = spell;
+	owner = owner_;
+	ownerPtr = (const LevelObject*)owner_.get();
+	position = origin;
+	velocity = {};
+	auto direction = target - origin;
+	auto length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+	if (speed > 0 && length > 0.f)
+	{
+		velocity = direction * ((float)speed / length);
+	}
+	timeLeft = sf::milliseconds(duration);
+	hitInterval = sf::milliseconds(hitInterval_);
+	nextHit = sf::Time::Zero;
+	damage = damage_;
+	damageType = GameUtils::getDamageType(spell->SpellType());
+	hitCount = 0;
+	expired = false;
+	queuedActions.clear();
+	lightSource = spell->getLightSource();
+
+	animation.setTexturePack(spell->getProjectileTexturePack());
+	if (animation.holdsNullTexturePack() == false)
+	{
+		auto playerDirection = getPlayerDirection(origin, target);
+		animation.setAnimation(0, (int32_t)playerDirection, true, true);
+		updateTexture();
+	}
+}
+
+bool Projectile::hitCell(LevelMap& map, const PairInt32& cell)
+{
+	if (map.isMapCoordValid(cell) == false)
+	{
+		return true;
+	}
+	const auto& mapCell = map[cell];
+	if (mapCell.PassableIgnoreObject() == false)
+	{
+		return true;
+	}
+	if (mapCell.hasObject(LevelObjectType::Player) == false)
+	{
+		return false;
+	}
+	bool hit = false;
+	for (auto obj : mapCell)
+	{
+		if (obj == ownerPtr ||
+			obj->getObjectType() != LevelObjectType::Player)
+		{
+			continue;
+		}
+		if (PlayerCombat::addDamage(*static_cast<PlayerBase*>(obj), owner, damage, damageType) == true)
+		{
+			hitCount++;
+			hit = true;
+		}
+	}
+	return hit;
+}
+
+bool Projectile::step(LevelMap& map, sf::Time elapsedTime)
+{
+	if (expired == true)
+	{
+		return false;
+	}
+	timeLeft -= elapsedTime;
+
+	if (velocity.x == 0.f && velocity.y == 0.f)
+	{
+		// area effect. hits once if there's no hit interval.
+		nextHit -= elapsedTime;
+		if (nextHit <= sf::Time::Zero)
+		{
+			auto cell = PairInt32((int32_t)std::floor(position.x), (int32_t)std::floor(position.y));
+			if (map.isMapCoordValid(cell) == false ||
+				map[cell].PassableIgnoreObject() == false)
+			{
+				expired = true;
+			}
+			else
+			{
+				hitCell(map, cell);
+				if (hitInterval > sf::Time::Zero)
+				{
+					nextHit += hitInterval;
+				}
+				else
+				{
+					// never again
+					nextHit = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+				}
+			}
+		}
+	}
+	else
+	{
+		auto newPosition = position + velocity * elapsedTime.asSeconds();
+		auto delta = newPosition - position;
+		auto length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+		if (length > MaxStep)
+		{
+			newPosition = position + delta * (MaxStep / length);
+		}
+		PairInt32 lastCell;
+		bool stopped = forEachCellOnSegment(position, newPosition, [&](const PairInt32& cell)
+			{
+				lastCell = cell;
+				return hitCell(map, cell) == false;
+			}) == false;
+		if (stopped == true)
+		{
+			expired = true;
+			newPosition = PairFloat((float)lastCell.x + 0.5f, (float)lastCell.y + 0.5f);
+		}
+		position = newPosition;
+	}
+	if (timeLeft <= sf::Time::Zero)
+	{
+		expired = true;
+	}
+
+	auto cellPos = PairFloat(std::floor(position.x), std::floor(position.y));
+	if (cellPos != mapPosition)
+	{
+		updateMapPositionBack(map, cellPos);
+	}
+	updateDrawPosition(map, position - PairFloat(0.5f, 0.5f));
+
+	return expired == false;
+}
+
+void Projectile::updateFrame(sf::Time elapsedTime, const LevelMap&)
+{
+	frameUpdated = hasValidState() == true && animation.update(elapsedTime) == true;
+	frameStepped = true;
+}
+
+void Projectile::update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr)
+{
+	if (frameStepped == false)
+	{
+		updateFrame(game.getElapsedTime(), level.Map());
+	}
+	frameStepped = false;
+	if (frameUpdated == true)
+	{
+		updateTexture();
+		frameUpdated = false;
+	}
+	auto oldHitCount = hitCount;
+	step(level.Map(), game.getElapsedTime());
+	if (hitCount != oldHitCount)
+	{
+		class_->executeAction(game, str2int16("hit"));
+	}
+	if (expired == true)
+	{
+		class_->executeAction(game, str2int16("expire"));
+	}
+}
+
+bool Projectile::getNumberByHash(const Queryable& owner, uint16_t propHash, LevelObjValue& value) const
+{
+	switch (propHash)
+	{
+	case str2int16("damage"):
+		value = damage;
+		return true;
+	case str2int16("hitCount"):
+		value = (LevelObjValue)hitCount;
+		return true;
+	case str2int16("timeLeft"):
+		value = (LevelObjValue)timeLeft.asMilliseconds();
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool Projectile::getProperty(const std::string_view prop, Variable& var) const
+{
+	if (prop.empty() == true)
+	{
+		return false;
+	}
+	auto props = Utils::splitStringIn2(prop, '.');
+	auto propHash = str2int16(props.first);
+	if (getLevelObjProp(propHash, props.second, var) == true)
+	{
+		return true;
+	}
+	switch (propHash)
+	{
+	case str2int16("expired"):
+		var = Variable(expired);
+		return true;
+	case str2int16("owner"):
+	{
+		if (auto obj = owner.lock())
+		{
+			var = Variable(obj->getId());
+			return true;
+		}
+		return false;
+	}
+	default:
+	{
+		LevelObjValue value;
+		if (getNumberByHash(*this, propHash, value) == true)
+		{
+			var = Variable((int64_t)value);
+			return true;
+		}
+		return Class()->getProperty(prop, var);
+	}
+	}
+}
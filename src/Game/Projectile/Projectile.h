@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Game/LevelObject/LevelObject.h"
+#include "Game/Properties/DamageType.h"
+#include "Game/Spell/Spell.h"
+#include <memory>
+#include <SFML/System/Time.hpp>
+
+class PlayerBase;
+
+// spell projectile that moves through the level map and hits the first player or wall
+// in its way. a projectile with speed 0 is an area effect (ex: fire wall) that hits
+// the players in its cell every hit interval until it expires.
+// projectiles are pooled by the LevelObjectManager and reused once they expire.
+class Projectile final : public LevelObject
+{
+private:
+	std::weak_ptr<PlayerBase> owner;
+	const LevelObject* ownerPtr{ nullptr };
+
+	// position inside the map (cell + fraction) and velocity in cells per second.
+	PairFloat position;
+	PairFloat velocity;
+
+	sf::Time timeLeft;
+	sf::Time hitInterval;
+	sf::Time nextHit;
+
+	LevelObjValue damage{ 0 };
+	DamageType damageType{ DamageType::Physical };
+
+	uint32_t hitCount{ 0 };
+	bool expired{ false };
+
+	bool hitCell(LevelMap& map, const PairInt32& cell);
+
+public:
+	Projectile(const Spell* spell);
+
+	constexpr auto Class() const noexcept { return (const Spell*)class_; }
+
+	static constexpr LevelObjectType ObjectType = LevelObjectType::Projectile;
+
+	// max distance moved in one step, so long frames don't tunnel through the map.
+	static constexpr float MaxStep = 4.f;
+
+	bool Passable() const noexcept override { return true; }
+
+	const std::string_view getType() const override { return "projectile"; }
+
+	// resets the projectile (reused from the pool) to fire from origin towards target.
+	// speed is in cells per second and duration in milliseconds.
+	void init(const Spell* spell, const std::shared_ptr<PlayerBase>& owner_,
+		const PairFloat& origin, const PairFloat& target, LevelObjValue damage_,
+		LevelObjValue speed, LevelObjValue duration, LevelObjValue hitInterval_);
+
+	// moves the projectile and resolves the collisions with the cells it crossed.
+	// returns false once it expired. doesn't use the game, so it can run headless.
+	bool step(LevelMap& map, sf::Time elapsedTime);
+
+	void updateFrame(sf::Time elapsedTime, const LevelMap& map) override;
+	void update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr) override;
+
+	bool getNumberByHash(const Queryable& owner, uint16_t propHash, LevelObjValue& value) const override;
+
+	bool getProperty(const std::string_view prop, Variable& var) const override;
+
+	auto& ExactPosition() const noexcept { return position; }
+	auto& Velocity() const noexcept { return velocity; }
+	auto TimeLeft() const noexcept { return timeLeft; }
+	auto Damage() const noexcept { return damage; }
+	auto HitCount() const noexcept { return hitCount; }
+	auto Expired() const noexcept { return expired; }
+};
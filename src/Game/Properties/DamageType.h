@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+enum class DamageType : uint8_t
+{
+	Physical,
+	Magic,
+	Fire,
+	Lightning
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <SFML/System/Time.hpp>
+
+enum class PlayerAIState : uint8_t
+{
+	Idle,
+	Alert,
+	Chase,
+	Attack,
+	Flee
+};
+
+// AI parameters of a player class. distances are in map cells.
+struct PlayerAIParams
+{
+	// the target is seen if it's closer than this and in line of sight.
+	float sightRadius{ 8.f };
+	// the target is lost if it's further than this.
+	float chaseRadius{ 12.f };
+	float attackRange{ 1.5f };
+	// flees when the life is below this % of the max life. 0 never flees.
+	int32_t fleeLife{ 0 };
+	// time between perception checks.
+	sf::Time thinkTime{ sf::milliseconds(250) };
+	// min time between path searches while chasing.
+	sf::Time replanTime{ sf::milliseconds(500) };
+	// time an alerted player searches for a target it lost before going idle.
+	sf::Time alertTime{ sf::milliseconds(3000) };
+};
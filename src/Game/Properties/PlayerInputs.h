@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+// inputs of the player's derived properties (life, mana, armor, ...).
+enum class PlayerInputs : uint32_t
+{
+	None = 0,
+	// body inventory items
+	Items = 1,
+	// strength, magic, dexterity, vitality
+	BaseStats = 2,
+	// level, experience, points
+	Level = 4,
+	// lifeDamage, manaDamage
+	Damage = 8,
+	// custom properties
+	Custom = 16,
+	// values summed from the body items (strengthItems, armorItems, ...)
+	ItemValues = 32,
+	All = 0xFFFFFFFF
+};
+
+constexpr PlayerInputs operator| (PlayerInputs a, PlayerInputs b) noexcept
+{
+	return (PlayerInputs)(static_cast<std::underlying_type_t<PlayerInputs>>(a) | static_cast<std::underlying_type_t<PlayerInputs>>(b));
+}
+constexpr PlayerInputs operator& (PlayerInputs a, PlayerInputs b) noexcept
+{
+	return (PlayerInputs)(static_cast<std::underlying_type_t<PlayerInputs>>(a) & static_cast<std::underlying_type_t<PlayerInputs>>(b));
+}
+constexpr PlayerInputs& operator|= (PlayerInputs& a, PlayerInputs b) noexcept { a = a | b; return a; }
@@ -7,6 +7,7 @@ enum class PlayerStatus : uint32_t
 	Stand,
 	Walk,
 	Attack,
+	Hit,
 	Dead,
 	Size
 };
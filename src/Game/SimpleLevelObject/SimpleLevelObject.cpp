@@ -1,10 +1,11 @@
 #include "SimpleLevelObject.h"
+#include "Game/Formula.h"
 #include "Game/Game.h"
 #include "Game/Level/Level.h"
 #include "SimpleLevelObjectLevelObject.h"
 #include "SimpleLevelObjectSave.h"
 
-SimpleLevelObject::SimpleLevelObject(const SimpleLevelObjectClass* class__) : LevelObject(class__)
+SimpleLevelObject::SimpleLevelObject(const SimpleLevelObjectClass* class__) : LevelObject(class__, ObjectType)
 {
 	if (class__->getTexture() != nullptr)
 	{
@@ -74,19 +75,26 @@ bool SimpleLevelObject::setIntByHash(uint16_t propHash, LevelObjValue value)
 	return false;
 }
 
-void SimpleLevelObject::update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr)
+void SimpleLevelObject::updateFrame(sf::Time elapsedTime, const LevelMap& map)
 {
-	updateHover(game, level, thisPtr);
-
 	const auto& rect = sprite.getTextureRect();
 	if (rect.width > 0 && rect.height > 0)
 	{
-		updateDrawPosition(level.Map());
+		updateDrawPosition(map);
 	}
-	if (hasValidState() == true)
+	frameUpdated = hasValidState() == true && animation.update(elapsedTime) == true;
+	frameStepped = true;
+}
+
+void SimpleLevelObject::update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr)
+{
+	updateHover(game, level, thisPtr);
+	if (frameStepped == false)
 	{
-		animation.update(game.getElapsedTime());
+		updateFrame(game.getElapsedTime(), level.Map());
 	}
+	frameStepped = false;
+	frameUpdated = false;
 }
 
 void SimpleLevelObject::updateNameAndDescriptions() const
@@ -94,6 +102,7 @@ void SimpleLevelObject::updateNameAndDescriptions() const
 	if (updateNameAndDescr == true)
 	{
 		updateNameAndDescr = false;
+		Formula::CosmeticScope cosmeticScope;
 		if (Class()->getFullName(*this, name) == false &&
 			name.empty() == true)
 		{
@@ -7,7 +7,7 @@
 #include "Utils/FixedMap.h"
 #include "Utils/UnorderedStringMap.h"
 
-class SimpleLevelObject : public LevelObject
+class SimpleLevelObject final : public LevelObject
 {
 private:
 	friend class SimpleLevelObjectLevelObject;
@@ -32,10 +32,13 @@ public:
 
 	constexpr auto Class() const noexcept { return (const SimpleLevelObjectClass*)class_; }
 
+	static constexpr LevelObjectType ObjectType = LevelObjectType::SimpleLevelObject;
+
 	bool Passable() const noexcept override { return true; }
 
 	const std::string_view getType() const override { return "levelObject"; }
 
+	void updateFrame(sf::Time elapsedTime, const LevelMap& map) override;
 	void update(Game& game, Level& level, const std::shared_ptr<LevelObject>& thisPtr) override;
 
 	bool getNumber(const std::string_view prop, Number32& value) const override;
@@ -1,4 +1,5 @@
 #include "Spell.h"
+#include "Game/Formula.h"
 #include "Game/Utils/GameUtils.h"
 #include "Utils/StringHash.h"
 #include "Utils/Utils.h"
@@ -99,6 +100,12 @@ bool Spell::getProperty(const std::string_view prop, Variable& var) const
 	return getProperty(*this, *this, propHash, props.second, var);
 }
 
+bool Spell::getPropertyByHash(const std::string_view prop, uint16_t propHash,
+	const std::string_view propArgs, Variable& var) const
+{
+	return getProperty(*this, *this, propHash, propArgs, var);
+}
+
 void Spell::setDescription(size_t idx, Classifier* classifier, uint16_t skipFirst)
 {
 	descriptionClassifiers.set(idx, classifier, skipFirst);
@@ -226,6 +233,7 @@ bool Spell::setIntByHash(uint16_t propHash, LevelObjValue value)
 		return false;
 	}
 	updateDescr = true;
+	propertyVersion = Classifier::newPropertyVersion();
 	return true;
 }
 
@@ -234,6 +242,7 @@ void Spell::updateDescriptions(const Queryable& spellObj) const
 	if (updateDescr == true)
 	{
 		updateDescr = false;
+		Formula::CosmeticScope cosmeticScope;
 		for (size_t i = 0; i < descriptions.size(); i++)
 		{
 			getDescription(i, spellObj, descriptions[i]);
@@ -251,31 +260,31 @@ void Spell::setFormula(uint16_t nameHash, const std::string_view formula)
 	{
 	case str2int16("life"):
 	{
-		formulas[0] = formula;
+		formulas[0] = Formula(formula, RandomStream::Combat);
 		break;
 	}
 	case str2int16("mana"):
 	{
-		formulas[1] = formula;
+		formulas[1] = Formula(formula, RandomStream::Combat);
 		break;
 	}
 	case str2int16("damage"):
 	{
-		formulas[2] = formula;
+		formulas[2] = Formula(formula, RandomStream::Combat);
 		break;
 	}
 	case str2int16("duration"):
 	{
-		formulas[3] = formula;
+		formulas[3] = Formula(formula, RandomStream::Combat);
 		break;
 	}
 	case str2int16("speed"):
 	{
-		formulas[4] = formula;
+		formulas[4] = Formula(formula, RandomStream::Combat);
 		break;
 	}
 	default:
-		customFormulas.setValue(nameHash, formula);
+		customFormulas.setValue(nameHash, Formula(formula, RandomStream::Combat));
 		break;
 	}
 }
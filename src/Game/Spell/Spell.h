@@ -23,6 +23,9 @@ private:
 	uint32_t textureIdx1;
 	uint32_t textureIdx2;
 
+	// animation of the spell's projectile in the level (one direction per player direction)
+	std::shared_ptr<TexturePack> projectileTexturePack;
+
 	Formulas<std::array<Formula, 6>> formulas;
 	FixedMap<uint16_t, Formula, 4> customFormulas;
 
@@ -34,6 +37,7 @@ private:
 
 	mutable std::array<std::string, 5> descriptions;
 	mutable bool updateDescr{ true };
+	uint32_t propertyVersion{ Classifier::newPropertyVersion() };
 
 	Classifiers<5> descriptionClassifiers;
 
@@ -74,6 +78,9 @@ public:
 	bool getProperty(const Queryable& spell, const Queryable& player, uint16_t propHash, const std::string_view prop, Variable& var) const;
 
 	bool getProperty(const std::string_view prop, Variable& var) const override;
+	bool getPropertyByHash(const std::string_view prop, uint16_t propHash,
+		const std::string_view propArgs, Variable& var) const override;
+	uint32_t PropertyVersion() const noexcept override { return propertyVersion; }
 
 	bool getTexture(uint32_t textureNumber, TextureInfo& ti) const override;
 
@@ -83,6 +90,9 @@ public:
 	void setTextureIndex1(uint32_t idx_) noexcept { textureIdx1 = idx_; }
 	void setTextureIndex2(uint32_t idx_) noexcept { textureIdx2 = idx_; }
 
+	auto& getProjectileTexturePack() const noexcept { return projectileTexturePack; }
+	void setProjectileTexturePack(const std::shared_ptr<TexturePack>& texturePack_) noexcept { projectileTexturePack = texturePack_; }
+
 	bool getTexture1(TextureInfo& ti) const { return texturePack1->get(textureIdx1, ti); }
 	bool getTexture2(TextureInfo& ti) const { return texturePack2->get(textureIdx2, ti); }
 
@@ -9,14 +9,19 @@ bool SpellInstance::getProperty(const std::string_view prop, Variable& var) cons
 		return false;
 	}
 	auto props = Utils::splitStringIn2(prop, '.');
-	auto propHash = str2int16(props.first);
+	return getPropertyByHash(prop, str2int16(props.first), props.second, var);
+}
+
+bool SpellInstance::getPropertyByHash(const std::string_view prop, uint16_t propHash,
+	const std::string_view propArgs, Variable& var) const
+{
 	switch (propHash)
 	{
 	case str2int16("level"):
 		var = Variable((int64_t)spellLevel);
 		break;
 	default:
-		return spell->getProperty(*this, *spellOwner, propHash, props.second, var);
+		return spell->getProperty(*this, *spellOwner, propHash, propArgs, var);
 	}
 	return true;
 }
@@ -19,5 +19,7 @@ struct SpellInstance : public LevelObjectQueryable
 
 	bool getNumber(const std::string_view prop, Number32& value) const override;
 	bool getProperty(const std::string_view prop, Variable& var) const override;
+	bool getPropertyByHash(const std::string_view prop, uint16_t propHash,
+		const std::string_view propArgs, Variable& var) const override;
 	bool getTexture(uint32_t textureNumber, TextureInfo& ti) const override;
 };
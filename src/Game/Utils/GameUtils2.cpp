@@ -5,6 +5,22 @@
 
 namespace GameUtils
 {
+	DamageType getDamageType(const std::string_view str, DamageType val)
+	{
+		switch (str2int16(Utils::toLower(str)))
+		{
+		case str2int16("physical"):
+			return DamageType::Physical;
+		case str2int16("magic"):
+			return DamageType::Magic;
+		case str2int16("fire"):
+			return DamageType::Fire;
+		case str2int16("lightning"):
+			return DamageType::Lightning;
+		}
+		return val;
+	}
+
 	InventoryPosition getInventoryPosition(const std::string_view str, InventoryPosition val)
 	{
 		switch (str2int16(Utils::toLower(str)))
@@ -21,6 +37,20 @@ namespace GameUtils
 		return val;
 	}
 
+	LevelUpdateMode getLevelUpdateMode(const std::string_view str, LevelUpdateMode val)
+	{
+		switch (str2int16(Utils::toLower(str)))
+		{
+		case str2int16("serial"):
+			return LevelUpdateMode::Serial;
+		case str2int16("parallel"):
+			return LevelUpdateMode::Parallel;
+		case str2int16("verifyframes"):
+			return LevelUpdateMode::VerifyFrames;
+		}
+		return val;
+	}
+
 	PlayerAnimation getPlayerAnimation(const std::string_view str, PlayerAnimation val)
 	{
 		switch (str2int16(Utils::toLower(str)))
@@ -161,6 +191,8 @@ namespace GameUtils
 			return PlayerStatus::Walk;
 		case str2int16("attack"):
 			return PlayerStatus::Attack;
+		case str2int16("hit"):
+			return PlayerStatus::Hit;
 		case str2int16("dead"):
 			return PlayerStatus::Dead;
 		default:
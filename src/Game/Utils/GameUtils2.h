@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Game/Level/LevelUpdateMode.h"
+#include "Game/Properties/DamageType.h"
 #include "Game/Properties/InventoryPosition.h"
 #include "Game/Properties/PlayerAnimation.h"
 #include "Game/Properties/PlayerDirection.h"
@@ -10,8 +12,12 @@
 
 namespace GameUtils
 {
+	DamageType getDamageType(const std::string_view str, DamageType val = DamageType::Physical);
+
 	InventoryPosition getInventoryPosition(const std::string_view str, InventoryPosition val = InventoryPosition::TopLeft);
 
+	LevelUpdateMode getLevelUpdateMode(const std::string_view str, LevelUpdateMode val);
+
 	PlayerAnimation getPlayerAnimation(const std::string_view str, PlayerAnimation val);
 
 	PlayerDirection getPlayerDirection(const std::string_view str, PlayerDirection val);
@@ -1,4 +1,5 @@
 #include "Game/Game2.h"
+#include "Game/Utils/CmdLineUtils.h"
 #include "Game/Utils/CmdLineUtils2.h"
 #include "Game/Utils/FileUtils.h"
 #include <iostream>
@@ -10,11 +11,18 @@ int main(int argc, char* argv[])
 
 	FileUtils::initPhysFS(argv[0]);
 
+	int exitCode = 0;
+
 	try
 	{
 		Game2 game;
 
-		if (CmdLineUtils::processCmdLine2(argc, (const char**)argv) == false)
+		CmdLineUtils::processSeed(argc, (const char**)argv);
+		if (CmdLineUtils::processInputRecording(argc, (const char**)argv, game) == false)
+		{
+			exitCode = 1;
+		}
+		else if (CmdLineUtils::processCmdLine2(argc, (const char**)argv) == false)
 		{
 			if (argc == 2)
 			{
@@ -29,6 +37,10 @@ int main(int argc, char* argv[])
 				game.load(".", "main.json");
 			}
 			game.play();
+			if (game.Recorder().hasReplayFailed() == true)
+			{
+				exitCode = 1;
+			}
 		}
 	}
 	catch (std::exception& ex)
@@ -37,5 +49,5 @@ int main(int argc, char* argv[])
 	}
 
 	FileUtils::deinitPhysFS();
-	return 0;
+	return exitCode;
 }
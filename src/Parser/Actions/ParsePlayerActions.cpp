@@ -36,6 +36,26 @@ namespace Parser2::Actions
 			getBoolKey(elem, "remove"));
 	}
 
+	std::shared_ptr<Action> parsePlayerAttack(const Value& elem)
+	{
+		return std::make_shared<ActPlayerAttack>(
+			getStringViewKey(elem, "player"),
+			getStringViewKey(elem, "level"),
+			getStringViewKey(elem, "target", "hoverObject"),
+			getPlayerAnimationKey(elem, "animation", PlayerAnimation::Attack1),
+			getDamageTypeKey(elem, "damageType"),
+			getBoolKey(elem, "ranged"));
+	}
+
+	std::shared_ptr<Action> parsePlayerCastSpell(const Value& elem)
+	{
+		return std::make_shared<ActPlayerCastSpell>(
+			getStringViewKey(elem, "player"),
+			getStringViewKey(elem, "level"),
+			getStringViewKey(elem, "spell"),
+			getStringViewKey(elem, "target"));
+	}
+
 	std::shared_ptr<Action> parsePlayerMove(const Value& elem)
 	{
 		return std::make_shared<ActPlayerMove>(
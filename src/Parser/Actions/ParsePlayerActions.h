@@ -10,6 +10,10 @@ namespace Parser2::Actions
 
 	std::shared_ptr<Action> parsePlayerAddToProperty(const rapidjson::Value& elem);
 
+	std::shared_ptr<Action> parsePlayerAttack(const rapidjson::Value& elem);
+
+	std::shared_ptr<Action> parsePlayerCastSpell(const rapidjson::Value& elem);
+
 	std::shared_ptr<Action> parsePlayerMove(const rapidjson::Value& elem);
 
 	std::shared_ptr<Action> parsePlayerRemoveItemQuantity(const rapidjson::Value& elem);
@@ -1,6 +1,7 @@
 #include "ParseLevel.h"
 #include "Game/Game.h"
 #include "Game/Level/Level.h"
+#include "Game/Utils/GameUtils2.h"
 #include "Json/JsonUtils.h"
 #include "ParseLevelAutoMap.h"
 #include "ParseLevelMap.h"
@@ -70,6 +71,12 @@ namespace Parser
 			auto smoothMovement = getBoolVal(getQueryVal(queryObj, elem["smoothMovement"sv]));
 			level->setSmoothMovement(smoothMovement);
 		}
+		if (elem.HasMember("updateMode"sv) == true)
+		{
+			auto updateMode = GameUtils::getLevelUpdateMode(
+				getStringViewVal(getQueryVal(queryObj, elem["updateMode"sv])), level->getUpdateMode());
+			level->setUpdateMode(updateMode);
+		}
 		if (elem.HasMember("lightRadius"sv) == true)
 		{
 			level->LightRadius((float)getUIntVal(getQueryVal(queryObj, elem["lightRadius"sv]), 64));
@@ -61,6 +61,10 @@ namespace Parser
 			auto index = (int16_t)getIntVal(elem["automapPlayerDirectionIndex"sv], -1);
 			level.setAutomapPlayerDirectionBaseIndex(index);
 		}
+		if (elem.HasMember("automapExploredOnly"sv) == true)
+		{
+			level.AutomapExploredOnly(getBoolVal(elem["automapExploredOnly"sv]));
+		}
 		if (elem.HasMember("showAutomap"sv) == true)
 		{
 			level.ShowAutomap(getBoolVal(elem["showAutomap"sv]));
@@ -1,8 +1,10 @@
 #include "ParseLevelMap.h"
 #include "Game/Game.h"
+#include "Game/Level/DungeonGenerator.h"
 #include "Game/Level/Level.h"
 #include "Game/Level/LevelMap.h"
 #include "Json/JsonUtils.h"
+#include <limits>
 #include "ParseLevelLayer.h"
 #include "Parser/Utils/ParseUtils.h"
 #include "Parser/Utils/ParseUtilsGameKey.h"
@@ -16,9 +18,115 @@ namespace Parser
 	using namespace rapidjson;
 	using namespace std::literals;
 
+	std::vector<int32_t> getDungeonTileIndexes(const Value& elem, const std::string_view key)
+	{
+		std::vector<int32_t> indexes;
+		if (elem.HasMember(key) == true)
+		{
+			const auto& elemKey = elem[key];
+			if (elemKey.IsArray() == true)
+			{
+				for (const auto& val : elemKey)
+				{
+					indexes.push_back(getIntVal(val, -1));
+				}
+			}
+			else
+			{
+				indexes.push_back(getIntVal(elemKey, -1));
+			}
+		}
+		return indexes;
+	}
+
+	// tile indexes for each cell type, inline or from a json file (one per tileset).
+	void parseDungeonTiles(const Value& elem, DungeonTiles& tiles)
+	{
+		if (elem.IsString() == true)
+		{
+			Document doc;
+			if (JsonUtils::loadFile(getStringViewVal(elem), doc) == true &&
+				doc.IsObject() == true)
+			{
+				parseDungeonTiles(doc, tiles);
+			}
+			return;
+		}
+		if (elem.IsObject() == false)
+		{
+			return;
+		}
+		tiles.empty = getIntKey(elem, "empty", tiles.empty);
+		tiles.floor = getDungeonTileIndexes(elem, "floor");
+		tiles.wall = getDungeonTileIndexes(elem, "wall");
+		tiles.wallX = getDungeonTileIndexes(elem, "wallX");
+		tiles.wallY = getDungeonTileIndexes(elem, "wallY");
+		tiles.door = getDungeonTileIndexes(elem, "door");
+	}
+
+	void parseDungeon(const Value& elem, LevelMap& map,
+		const PairInt32& mapPos, int32_t defaultTile, bool resizeToFit)
+	{
+		DungeonParams params;
+		params.type = getStringViewKey(elem, "type") == "caves" ? DungeonType::Caves : DungeonType::Rooms;
+		params.size = getVector2iKey<PairInt32>(elem, "size", params.size);
+		if (elem.HasMember("seed"sv) == true)
+		{
+			params.seed = getUInt64Key(elem, "seed");
+		}
+		else
+		{
+			params.seed = Random::get(RandomStream::Level, std::numeric_limits<uint32_t>::max());
+		}
+		params.numRooms = getVector2iKey<PairInt32>(elem, "rooms", params.numRooms);
+		params.roomSize = getVector2iKey<PairInt32>(elem, "roomSize", params.roomSize);
+		params.fill = getIntKey(elem, "fill", params.fill);
+		params.iterations = getIntKey(elem, "iterations", params.iterations);
+		params.tiles.empty = defaultTile;
+		if (elem.HasMember("tiles"sv) == true)
+		{
+			parseDungeonTiles(elem["tiles"sv], params.tiles);
+		}
+
+		auto layout = DungeonGenerator::generate(params);
+		auto pos = getVector2iKey<PairInt32>(elem, "position");
+		pos.x += mapPos.x;
+		pos.y += mapPos.y;
+		if (resizeToFit == true)
+		{
+			map.resize(pos.x + layout.size.x, pos.y + layout.size.y);
+		}
+		map.setSimpleAreaUseFlags(0, pos.x, pos.y,
+			DungeonGenerator::getTiles(layout, params.tiles, params.seed));
+		if (getBoolKey(elem, "setFlags") == true)
+		{
+			map.setSimpleArea(LevelCell::FlagsLayer, pos.x, pos.y,
+				DungeonGenerator::getFlags(layout));
+		}
+	}
+
 	void parseMapObj(const Value* queryDoc, const Value& elem, LevelMap& map,
 		const PairInt32& mapPos, int32_t defaultTile, bool resizeToFit)
 	{
+		if (elem.HasMember("generate"sv) == true)
+		{
+			const auto& elemGen = elem["generate"sv];
+			if (elemGen.IsString() == true)
+			{
+				Document genDoc;
+				if (JsonUtils::loadFile(getStringViewVal(elemGen), genDoc) == true &&
+					genDoc.IsObject() == true)
+				{
+					parseDungeon(genDoc, map, mapPos, defaultTile, resizeToFit);
+				}
+			}
+			else if (elemGen.IsObject() == true)
+			{
+				parseDungeon(elemGen, map, mapPos, defaultTile, resizeToFit);
+			}
+			return;
+		}
+
 		std::string file;
 
 		if (elem.HasMember("file"sv) == true)
@@ -30,7 +138,7 @@ namespace Parser
 				auto rndMax = getUIntVal(elem["random"sv]);
 				if (rndMax > 0)
 				{
-					auto rnd = Random::get(rndMax);
+					auto rnd = Random::get(RandomStream::Level, rndMax);
 					Utils::replaceStringInPlace(file, "!random!", std::to_string(rnd));
 				}
 			}
@@ -183,6 +291,16 @@ namespace Parser
 		{
 			parseMap(queryDoc, elem, *mapPtr, defaultTile);
 		}
+		if (elem.HasMember("exploredCells"sv) == true &&
+			elem["exploredCells"sv].IsArray() == true)
+		{
+			std::vector<uint32_t> runs;
+			for (const auto& val : elem["exploredCells"sv])
+			{
+				runs.push_back(getUIntVal(val));
+			}
+			mapPtr->setExploredCells(runs);
+		}
 		if (elem.HasMember("lightMap"sv) == true)
 		{
 			mapPtr->loadLightMap(getStringViewVal(getQueryKey(queryDoc, elem, "lightMap")));
@@ -182,6 +182,14 @@ namespace Parser2
 		{
 			return Actions::parsePlayerAddToProperty(elem);
 		}
+		case str2int16("player.attack"):
+		{
+			return Actions::parsePlayerAttack(elem);
+		}
+		case str2int16("player.castSpell"):
+		{
+			return Actions::parsePlayerCastSpell(elem);
+		}
 		case str2int16("player.move"):
 		{
 			return Actions::parsePlayerMove(elem);
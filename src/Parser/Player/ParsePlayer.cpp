@@ -84,11 +84,13 @@ namespace Parser
 			player->updateLevelFromExperience(*level, false);
 		}
 
+		// one properties update after all the items are equipped
+		player->beginUpdateProperties();
 		parsePlayerInventories(*player, *level, elem);
 		parsePlayerSpells(*player, *level, elem);
 
 		player->MapPosition(level->Map(), mapPos);
-		player->updateProperties();
+		player->endUpdateProperties();
 		player->updateTexture();
 
 		if (getBoolKey(elem, "currentPlayer") == true)
@@ -1,4 +1,5 @@
 #include "ParsePlayerClass.h"
+#include <algorithm>
 #include "Game/Game.h"
 #include "Game/Level/Level.h"
 #include "Game/Player/PlayerClass.h"
@@ -37,6 +38,23 @@ namespace Parser
 		);
 	}
 
+	void parsePlayerAIParams(PlayerClass& playerClass, const Value& elem)
+	{
+		if (elem.IsObject() == false)
+		{
+			return;
+		}
+		PlayerAIParams params;
+		params.sightRadius = getFloatKey(elem, "sightRadius", params.sightRadius);
+		params.chaseRadius = std::max(getFloatKey(elem, "chaseRadius", params.chaseRadius), params.sightRadius);
+		params.attackRange = getFloatKey(elem, "attackRange", params.attackRange);
+		params.fleeLife = getIntKey(elem, "fleeLife", params.fleeLife);
+		params.thinkTime = std::max(getTimeKey(elem, "thinkTime", params.thinkTime), sf::milliseconds(1));
+		params.replanTime = getTimeKey(elem, "replanTime", params.replanTime);
+		params.alertTime = getTimeKey(elem, "alertTime", params.alertTime);
+		playerClass.AIParams(params);
+	}
+
 	void parsePlayerSound(Game& game, PlayerClass& playerClass, const Value& elem)
 	{
 		auto sndId = getStringViewKey(elem, "sound");
@@ -246,6 +264,23 @@ namespace Parser
 			playerClass->MaxResistLightning(getIntVal(elem["maxResistLightning"sv], 100));
 		}
 
+		if (elem.HasMember("attackFrame"sv) == true)
+		{
+			playerClass->AttackFrame(getIntVal(elem["attackFrame"sv], -1));
+		}
+		if (elem.HasMember("hitRecoveryDamage"sv) == true)
+		{
+			playerClass->HitRecoveryDamage(getIntVal(elem["hitRecoveryDamage"sv], 1));
+		}
+		if (elem.HasMember("dropItemsOnDeath"sv) == true)
+		{
+			playerClass->DropItemsOnDeath(getBoolVal(elem["dropItemsOnDeath"sv]));
+		}
+		if (elem.HasMember("ai"sv) == true)
+		{
+			parsePlayerAIParams(*playerClass, elem["ai"sv]);
+		}
+
 		if (elem.HasMember("outline"sv) == true)
 		{
 			playerClass->Outline(getColorVal(elem["outline"sv], sf::Color::Transparent));
@@ -104,6 +104,11 @@ namespace Parser
 		{
 			spell->SpellType(getStringViewVal(elem["type"sv]));
 		}
+		if (elem.HasMember("projectileTexturePack"sv) == true)
+		{
+			spell->setProjectileTexturePack(game.Resources().getTexturePack(
+				getStringViewVal(elem["projectileTexturePack"sv])));
+		}
 
 		parseLevelObjectProperties(*spell, *level, elem);
 		parseLevelObjectClassDescriptions(*spell, *level, elem);
@@ -5,6 +5,20 @@ namespace Parser
 {
 	using namespace rapidjson;
 
+	DamageType getDamageTypeKey(const Value& elem, const std::string_view key, DamageType val)
+	{
+		if (elem.IsObject() == true &&
+			elem.HasMember(key) == true)
+		{
+			const auto& keyElem = elem[key];
+			if (keyElem.IsString() == true)
+			{
+				return GameUtils::getDamageType(keyElem.GetStringView(), val);
+			}
+		}
+		return val;
+	}
+
 	size_t getInventoryItemIndexKey(const Value& elem, const std::string_view key, PlayerInventory inv)
 	{
 		if (elem.IsObject() == true &&
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Game/Properties/DamageType.h"
 #include "Game/Properties/PlayerAnimation.h"
 #include "Game/Properties/PlayerDirection.h"
 #include "Game/Properties/PlayerItemMount.h"
@@ -8,6 +9,9 @@
 
 namespace Parser
 {
+	DamageType getDamageTypeKey(const rapidjson::Value& elem,
+		const std::string_view key, DamageType val = DamageType::Physical);
+
 	size_t getInventoryItemIndexKey(const rapidjson::Value& elem, const std::string_view key, PlayerInventory inv);
 
 	InventoryPosition getInventoryPositionKey(const rapidjson::Value& elem,